@@ -298,6 +298,13 @@ function(hpx_check_for_cxx17_std_in_place_type_t)
     FILE ${ARGN})
 endfunction()
 
+###############################################################################
+function(hpx_check_for_cxx17_std_is_aggregate)
+  add_hpx_config_test(HPX_WITH_CXX17_STD_IS_AGGREGATE
+    SOURCE cmake/tests/cxx17_std_is_aggregate.cpp
+    FILE ${ARGN})
+endfunction()
+
 ###############################################################################
 function(hpx_check_for_cxx17_structured_bindings)
   add_hpx_config_test(HPX_WITH_CXX17_STRUCTURED_BINDINGS
@@ -50,6 +50,9 @@ function(hpx_perform_cxx_feature_tests)
     hpx_check_for_cxx17_std_in_place_type_t(
       DEFINITIONS HPX_HAVE_CXX17_STD_IN_PLACE_TYPE_T)
 
+    hpx_check_for_cxx17_std_is_aggregate(
+      DEFINITIONS HPX_HAVE_CXX17_STD_IS_AGGREGATE)
+
   endif()
 
   # we deliberately check for this functionality even for non-C++17
@@ -0,0 +1,19 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <type_traits>
+
+struct aggregate
+{
+    int i;
+    double d;
+};
+
+int main()
+{
+    static_assert(std::is_aggregate<aggregate>::value, "");
+    static_assert(!std::is_aggregate<int>::value, "");
+}
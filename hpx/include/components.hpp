@@ -52,6 +52,7 @@
 
 #include <hpx/runtime/components/binpacking_distribution_policy.hpp>
 #include <hpx/runtime/components/colocating_distribution_policy.hpp>
+#include <hpx/runtime/components/communication_distribution_policy.hpp>
 #include <hpx/runtime/components/default_distribution_policy.hpp>
 #include <hpx/runtime/components/unwrapping_result_policy.hpp>
 
@@ -35,9 +35,18 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
         using connection_list = std::deque<connection_ptr>;
 
         using mutex_type = hpx::lcos::local::spinlock;
+        using buffer_pool_type = connection_type::buffer_pool_type;
 
         sender()
-          : next_free_tag_request_((MPI_Request)(-1))
+          : buffer_pool_(std::make_shared<buffer_pool_type>())
+          , next_free_tag_request_((MPI_Request)(-1))
+          , next_free_tag_(-1)
+        {
+        }
+
+        explicit sender(std::shared_ptr<buffer_pool_type> buffer_pool)
+          : buffer_pool_(std::move(buffer_pool))
+          , next_free_tag_request_((MPI_Request)(-1))
           , next_free_tag_(-1)
         {
         }
@@ -49,7 +58,13 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
 
         connection_ptr create_connection(int dest, parcelset::parcelport* pp)
         {
-            return std::make_shared<connection_type>(this, dest, pp);
+            return std::make_shared<connection_type>(
+                this, dest, pp, buffer_pool_);
+        }
+
+        buffer_pool_type& buffer_pool()
+        {
+            return *buffer_pool_;
         }
 
         void add(connection_ptr const & ptr)
@@ -111,6 +126,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
         }
 
     private:
+        // the pool is shared with the connections as those may outlive the
+        // sender
+        std::shared_ptr<buffer_pool_type> buffer_pool_;
+
         tag_provider tag_provider_;
 
         void next_free_tag()
@@ -15,6 +15,7 @@
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/plugins/parcelport/mpi/locality.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
@@ -63,7 +64,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             base_type;
 
     public:
-        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp)
+        typedef parcelset::detail::parcel_buffer_pool<
+                parcel_buffer<data_type>
+            > buffer_pool_type;
+
+        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp,
+                std::shared_ptr<buffer_pool_type> buffer_pool = nullptr)
           : state_(initialized)
           , sender_(s)
           , tag_(-1)
@@ -74,9 +80,37 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
           , ack_(0)
           , pp_(pp)
           , there_(parcelset::locality(locality(dst_)))
+          , buffer_pool_(std::move(buffer_pool))
         {
         }
 
+        ~sender_connection()
+        {
+            release_buffer();
+        }
+
+        /// Take a buffer from the pool for the next message, the buffer is
+        /// given back as soon as the message has been sent.
+        void acquire_buffer()
+        {
+            if (buffer_pool_ && buffer_.data_.capacity() == 0)
+                buffer_ = buffer_pool_->get();
+        }
+
+        // give the buffer back for reuse by other connections
+        void release_buffer()
+        {
+            if (!buffer_pool_)
+            {
+                buffer_.clear();
+                return;
+            }
+
+            parcel_buffer<data_type> buffer(std::move(buffer_));
+            buffer_.clear();
+            buffer_pool_->reclaim(std::move(buffer));
+        }
+
         parcelset::locality const& destination() const
         {
             return there_;
@@ -260,7 +294,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             buffer_.data_point_.time_ =
                 util::high_resolution_clock::now() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
-            buffer_.clear();
+
+            // idle (cached) connections don't hold on to a buffer
+            release_buffer();
 
             state_ = initialized;
 
@@ -314,6 +350,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
         parcelset::parcelport* pp_;
 
         parcelset::locality there_;
+
+        std::shared_ptr<buffer_pool_type> buffer_pool_;
     };
 }}}}
 
@@ -17,7 +17,10 @@
 #include <hpx/config/asio.hpp>
 
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
+#include <hpx/plugins/parcelport/tcp/stripe_registry.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
 #include <hpx/util_fwd.hpp>
 
@@ -108,12 +111,29 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+            std::int64_t get_buffer_pool_statistics(
+                buffer_pool_statistics_type t, bool reset) override
+            {
+                return buffer_pool_->get_statistics(t, reset);
+            }
+
         private:
             void handle_accept(boost::system::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
             void handle_read_completion(boost::system::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
 
+            /// Pool of send buffers shared by all outgoing connections
+            typedef parcelset::detail::parcel_buffer_pool<
+                    parcel_buffer<std::vector<char> >
+                > buffer_pool_type;
+            std::shared_ptr<buffer_pool_type> buffer_pool_;
+
+            /// Striping of large messages over several connections
+            std::size_t stripe_connections_;
+            std::size_t stripe_threshold_;
+            stripe_registry stripes_;
+
             /// Acceptor used to listen for incoming connections.
             boost::asio::ip::tcp::acceptor* acceptor_;
 
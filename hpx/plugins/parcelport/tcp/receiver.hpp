@@ -23,9 +23,11 @@
 #include <hpx/functional/protect.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/stripe_registry.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
+#include <hpx/util/integer/endian.hpp>
 #include <hpx/util/yield_while.hpp>
 
 #include <boost/asio/buffer.hpp>
@@ -59,11 +61,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, stripe_registry& stripes)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
+          , stripe_id_(0)
+          , stripe_direct_(false)
           , parcelport_(parcelport)
+          , stripes_(stripes)
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
@@ -170,11 +175,33 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     return;
                 }
 
+                // this connection carries a stripe of a striped message
+                if (static_cast<std::uint32_t>(buffer_.num_chunks_.first) ==
+                    stripe_marker)
+                {
+                    void (receiver::*f)(boost::system::error_code const&,
+                            Handler)
+                        = &receiver::handle_read_stripe_header<Handler>;
+
+                    async_read_next(
+                        boost::asio::buffer(&stripe_id_, sizeof(stripe_id_)),
+                        f, handler);
+                    return;
+                }
+
                 buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
 
                 // receive buffers
                 std::vector<boost::asio::mutable_buffer> buffers;
 
+                // the zero-copy chunks of this message are received over
+                // separate connections
+                bool striped = (static_cast<std::uint32_t>(
+                    buffer_.num_chunks_.second) & striped_message_flag) != 0;
+                buffer_.num_chunks_.second =
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.second) &
+                    ~striped_message_flag;
+
                 // determine the size of the chunk buffer
                 std::size_t num_zero_copy_chunks =
                     static_cast<std::size_t>(
@@ -205,7 +232,16 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
-                    f = &receiver::handle_read_chunk_data<Handler>;
+                    if (striped)
+                    {
+                        buffers.push_back(boost::asio::buffer(
+                            &stripe_id_, sizeof(stripe_id_)));
+                        f = &receiver::handle_read_striped_chunk_data<Handler>;
+                    }
+                    else
+                    {
+                        f = &receiver::handle_read_chunk_data<Handler>;
+                    }
                 }
                 else {
                     // add main buffer holding data which was serialized normally
@@ -298,6 +334,145 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             }
         }
 
+        /// Handle a completed read of the non-zero-copy data of a message whose
+        /// zero-copy chunks are received over separate connections.
+        template <typename Handler>
+        void handle_read_striped_chunk_data(
+            boost::system::error_code const& e, Handler handler)
+        {
+            if (e) {
+                handler(e);
+                --operation_in_flight_;
+                return;
+            }
+
+            // add appropriately sized chunk buffers for the zero-copy data
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            std::vector<boost::asio::mutable_buffer> targets;
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t chunk_size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                buffer_.chunks_[i].resize(chunk_size);
+                targets.push_back(
+                    boost::asio::buffer(buffer_.chunks_[i].data(), chunk_size));
+            }
+
+            // continue as soon as all stripes have arrived
+            void (receiver::*f)(boost::system::error_code const&, Handler)
+                = &receiver::handle_read_data<Handler>;
+
+            stripes_.register_message(stripe_id_, std::move(targets),
+                util::bind(f, shared_from_this(), util::placeholders::_1,
+                    util::protect(std::move(handler))));
+        }
+
+        /// Handle a completed read of the header of a stripe.
+        template <typename Handler>
+        void handle_read_stripe_header(boost::system::error_code const& e,
+            Handler handler)
+        {
+            if (e) {
+                handler(e);
+                --operation_in_flight_;
+                return;
+            }
+
+            std::size_t offset = static_cast<std::size_t>(buffer_.data_size_);
+            std::size_t size = static_cast<std::size_t>(buffer_.size_);
+
+            // receive the data directly into the chunks of the message if
+            // those are known already
+            std::vector<boost::asio::mutable_buffer> buffers;
+            stripe_direct_ =
+                stripes_.get_targets(stripe_id_, offset, size, buffers);
+            if (!stripe_direct_)
+            {
+                buffer_.data_.resize(size);
+                buffers.push_back(boost::asio::buffer(buffer_.data_));
+            }
+
+            void (receiver::*f)(boost::system::error_code const&, Handler)
+                = &receiver::handle_read_stripe_data<Handler>;
+
+            std::unique_lock<mutex_type> lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                boost::system::error_code ec =
+                    boost::asio::error::make_error_code(
+                        boost::asio::error::not_connected);
+
+                // the message this stripe belongs to can't be completed
+                stripes_.stripe_failed(stripe_id_, stripe_direct_, ec);
+                buffer_ = parcel_buffer_type();
+
+                // report this problem back to the handler
+                handler(ec);
+                return;
+            }
+            boost::asio::async_read(socket_, buffers,
+                util::bind(f, shared_from_this(),
+                    boost::asio::placeholders::error,
+                    util::protect(handler)));
+        }
+
+        /// Handle a completed read of the data of a stripe.
+        template <typename Handler>
+        void handle_read_stripe_data(boost::system::error_code const& e,
+            Handler handler)
+        {
+            if (e) {
+                // the message this stripe belongs to can't be completed
+                stripes_.stripe_failed(stripe_id_, stripe_direct_, e);
+                buffer_ = parcel_buffer_type();
+
+                handler(e);
+                --operation_in_flight_;
+                return;
+            }
+
+            if (stripe_direct_)
+            {
+                stripes_.stripe_received(stripe_id_,
+                    static_cast<std::size_t>(buffer_.size_));
+            }
+            else
+            {
+                stripes_.add_stripe(stripe_id_,
+                    static_cast<std::size_t>(buffer_.data_size_),
+                    std::move(buffer_.data_));
+            }
+            buffer_ = parcel_buffer_type();
+
+            // stripes are not acknowledged, wait for the next message
+            --operation_in_flight_;
+            async_read(handler);
+        }
+
+        template <typename Buffers, typename F, typename Handler>
+        void async_read_next(Buffers const& buffers, F f, Handler& handler)
+        {
+            std::unique_lock<mutex_type> lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+                // report this problem back to the handler
+                handler(boost::asio::error::make_error_code(
+                    boost::asio::error::not_connected));
+                return;
+            }
+            boost::asio::async_read(socket_, buffers,
+                util::bind(f, shared_from_this(),
+                    boost::asio::placeholders::error,
+                    util::protect(handler)));
+        }
+
         /// Handle a completed read of message data.
         template <typename Handler>
         void handle_read_data(boost::system::error_code const& e,
@@ -368,9 +543,16 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         bool ack_;
 
+        /// The id of the striped message currently being received
+        util::integer::ulittle64_t stripe_id_;
+        bool stripe_direct_;
+
         /// The handler used to process the incoming request.
         connection_handler& parcelport_;
 
+        /// The striped messages which are currently being received
+        stripe_registry& stripes_;
+
         /// Counters and timers for parcels received.
         util::high_resolution_timer timer_;
 
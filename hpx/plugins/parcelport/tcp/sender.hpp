@@ -19,18 +19,24 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
+#include <hpx/plugins/parcelport/tcp/stripe_registry.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/asio_util.hpp>
+#include <hpx/util/integer/endian.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 #include <hpx/functional/unique_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/connect.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/placeholders.hpp>
@@ -43,8 +49,11 @@
 #undef VT1
 #undef VT2
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -57,26 +66,60 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             boost::system::error_code const&)>;
 
     public:
+        using buffer_pool_type =
+            parcelset::detail::parcel_buffer_pool<parcel_buffer_type>;
+
         /// Construct a sending parcelport_connection with the given io_service.
+        /// Messages whose zero-copy data exceeds \a stripe_threshold bytes
+        /// are striped over \a stripe_connections additional connections if
+        /// \a stripe_connections is larger than one.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
-          : socket_(io_service)
+                parcelset::parcelport* pp,
+                std::shared_ptr<buffer_pool_type> buffer_pool = nullptr,
+                std::size_t stripe_connections = 1,
+                std::size_t stripe_threshold = 0)
+          : io_service_(io_service)
+          , socket_(io_service)
           , ack_(0)
+          , stripe_connections_(stripe_connections)
+          , stripe_threshold_(stripe_threshold)
+          , rails_connecting_(false)
+          , rails_connected_(0)
+          , stripe_id_(0)
+          , pending_writes_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , buffer_pool_(std::move(buffer_pool))
         {
         }
 
         ~sender()
         {
+            release_buffer();
+
             // gracefully and portably shutdown the socket
             if (socket_.is_open()) {
                 boost::system::error_code ec;
                 socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
                 socket_.close(ec);    // close the socket to give it back to the OS
             }
+
+            for (auto& rail : rails_)
+            {
+                boost::system::error_code ec;
+                rail->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+                rail->close(ec);
+            }
+        }
+
+        /// Take a buffer from the pool for the next message, the buffer is
+        /// given back as soon as the message has been sent.
+        void acquire_buffer()
+        {
+            if (buffer_pool_ && buffer_.data_.capacity() == 0)
+                buffer_ = buffer_pool_->get();
         }
 
         /// Get the socket associated with the parcelport_connection.
@@ -144,7 +187,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
-            if (!chunks.empty()) {
+            if (!chunks.empty() && should_stripe())
+            {
+                async_write_striped(std::move(buffers));
+                return;
+            }
+            else if (!chunks.empty()) {
                 buffers.push_back(
                     boost::asio::buffer(chunks.data(), chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type)));
@@ -177,6 +225,195 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         }
 
     private:
+        // Return whether the zero-copy chunks of the current message should
+        // be striped over the rail connections. The rails are connected
+        // asynchronously the first time a message qualifies for striping,
+        // messages are sent over this connection until all rails are up.
+        bool should_stripe()
+        {
+            if (stripe_connections_ <= 1)
+                return false;
+
+            std::size_t zero_copy_size = 0;
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                    zero_copy_size += c.size_;
+            }
+            if (zero_copy_size < stripe_threshold_ ||
+                zero_copy_size < stripe_connections_)
+            {
+                return false;
+            }
+
+            if (rails_connected_.load(std::memory_order_acquire) ==
+                stripe_connections_)
+            {
+                return true;
+            }
+
+            if (!rails_connecting_)
+            {
+                rails_connecting_ = true;
+                connect_rails();
+            }
+            return false;
+        }
+
+        void connect_rails()
+        {
+            // rail connections go to the same endpoint as this connection
+            boost::system::error_code ec;
+            boost::asio::ip::tcp::endpoint ep = socket_.remote_endpoint(ec);
+            if (ec)
+                return;
+
+            // all rails are created up front, the vector is not modified
+            // while the connections are being established
+            rails_.reserve(stripe_connections_);
+            for (std::size_t i = 0; i != stripe_connections_; ++i)
+            {
+                rails_.emplace_back(
+                    new boost::asio::ip::tcp::socket(io_service_));
+            }
+
+            void (sender::*f)(boost::system::error_code const&, std::size_t)
+                = &sender::handle_connect_rail;
+
+            using util::placeholders::_1;
+            for (std::size_t i = 0; i != stripe_connections_; ++i)
+            {
+                rails_[i]->async_connect(
+                    ep, util::bind(f, shared_from_this(), _1, i));
+            }
+        }
+
+        // If connecting a rail fails, the messages continue to be sent
+        // over this connection only.
+        void handle_connect_rail(boost::system::error_code const& e,
+            std::size_t rail)
+        {
+            if (e)
+                return;
+
+            boost::system::error_code ec;
+            rails_[rail]->set_option(boost::asio::ip::tcp::no_delay(true), ec);
+            rails_[rail]->set_option(
+                boost::asio::socket_base::linger(true, 0), ec);
+
+            ++rails_connected_;
+        }
+
+        // Send the message header and the non-zero-copy data over this
+        // connection while sending the zero-copy data in equally sized
+        // stripes over the rail connections.
+        void async_write_striped(std::vector<boost::asio::const_buffer>&& buffers)
+        {
+            stripe_id_ = next_stripe_id(hpx::get_locality_id());
+            pp_->add_striped_message();
+
+            buffer_.num_chunks_.second =
+                static_cast<std::uint32_t>(buffer_.num_chunks_.second) |
+                striped_message_flag;
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            buffers.push_back(
+                boost::asio::buffer(chunks.data(), chunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type)));
+            buffers.push_back(boost::asio::buffer(buffer_.data_));
+            buffers.push_back(
+                boost::asio::buffer(&stripe_id_, sizeof(stripe_id_)));
+
+            std::vector<boost::asio::const_buffer> zero_copy_buffers;
+            for (serialization::serialization_chunk& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                {
+                    zero_copy_buffers.push_back(
+                        boost::asio::buffer(c.data_.cpos_, c.size_));
+                }
+            }
+
+            std::size_t total_size = boost::asio::buffer_size(zero_copy_buffers);
+            std::size_t stripe_size =
+                (total_size + rails_.size() - 1) / rails_.size();
+
+            // trailing rails may not get any data, those are not used
+            std::size_t num_stripes =
+                (total_size + stripe_size - 1) / stripe_size;
+            HPX_ASSERT(num_stripes != 0 && num_stripes <= rails_.size());
+
+            stripe_error_ = boost::system::error_code();
+            pending_writes_ = num_stripes + 1;
+
+            void (sender::*f)(boost::system::error_code const&, std::size_t)
+                = &sender::handle_write_stripe;
+
+            using util::placeholders::_1;
+            using util::placeholders::_2;
+
+            stripe_headers_.resize(num_stripes);
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                std::size_t offset = i * stripe_size;
+                std::size_t size =
+                    (std::min)(stripe_size, total_size - offset);
+                HPX_ASSERT(size != 0);
+
+                stripe_header& h = stripe_headers_[i];
+                h.size_ = size;
+                h.offset_ = offset;
+                h.num_chunks_ =
+                    parcel_buffer_type::count_chunks_type(stripe_marker, 0);
+                h.stripe_id_ = stripe_id_;
+
+                std::vector<boost::asio::const_buffer> stripe;
+                stripe.push_back(boost::asio::buffer(&h.size_, sizeof(h.size_)));
+                stripe.push_back(
+                    boost::asio::buffer(&h.offset_, sizeof(h.offset_)));
+                stripe.push_back(
+                    boost::asio::buffer(&h.num_chunks_, sizeof(h.num_chunks_)));
+                stripe.push_back(
+                    boost::asio::buffer(&h.stripe_id_, sizeof(h.stripe_id_)));
+                slice_buffers(zero_copy_buffers, offset, size, stripe);
+
+                boost::asio::async_write(*rails_[i], stripe,
+                    util::bind(f, shared_from_this(), _1, _2));
+            }
+
+            boost::asio::async_write(socket_, buffers,
+                util::bind(f, shared_from_this(), _1, _2));
+        }
+
+        /// handle completed write operation of a striped message
+        void handle_write_stripe(
+            boost::system::error_code const& e, std::size_t bytes)
+        {
+            if (e)
+            {
+                std::lock_guard<lcos::local::spinlock> l(stripe_mtx_);
+                if (!stripe_error_)
+                    stripe_error_ = e;
+
+                // the receiver fails the message, send the following
+                // messages over this connection only
+                rails_connected_.store(0, std::memory_order_release);
+            }
+
+            // the parcels (which own the zero-copy data) may be released
+            // only after all stripes have been written
+            if (--pending_writes_ == 0)
+            {
+                boost::system::error_code ec;
+                {
+                    std::lock_guard<lcos::local::spinlock> l(stripe_mtx_);
+                    ec = stripe_error_;
+                }
+                handle_write(ec, bytes);
+            }
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -247,7 +484,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
-            buffer_.clear();
+            // idle (cached) connections don't hold on to a buffer
+            release_buffer();
+
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -262,11 +501,47 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             postprocess_handler(e, there_, shared_from_this());
         }
 
+        // give the buffer back for reuse by other connections
+        void release_buffer()
+        {
+            if (!buffer_pool_)
+            {
+                buffer_.clear();
+                return;
+            }
+
+            parcel_buffer_type buffer(std::move(buffer_));
+            buffer_.clear();
+            buffer_pool_->reclaim(std::move(buffer));
+        }
+
+        boost::asio::io_service& io_service_;
+
         /// Socket for the parcelport_connection.
         boost::asio::ip::tcp::socket socket_;
 
         bool ack_;
 
+        /// Additional connections used for striping large messages
+        struct stripe_header
+        {
+            util::integer::ulittle64_t size_;
+            util::integer::ulittle64_t offset_;
+            parcel_buffer_type::count_chunks_type num_chunks_;
+            util::integer::ulittle64_t stripe_id_;
+        };
+
+        std::size_t stripe_connections_;
+        std::size_t stripe_threshold_;
+        std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>> rails_;
+        bool rails_connecting_;
+        std::atomic<std::size_t> rails_connected_;
+        std::vector<stripe_header> stripe_headers_;
+        util::integer::ulittle64_t stripe_id_;
+        std::atomic<std::size_t> pending_writes_;
+        lcos::local::spinlock stripe_mtx_;
+        boost::system::error_code stripe_error_;
+
         /// the other (receiving) end of this connection
         parcelset::locality there_;
 
@@ -274,6 +549,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        /// pool the data buffer of this connection is recycled through
+        std::shared_ptr<buffer_pool_type> buffer_pool_;
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
@@ -0,0 +1,409 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_TCP_STRIPE_REGISTRY_HPP
+#define HPX_PARCELSET_POLICIES_TCP_STRIPE_REGISTRY_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP)
+
+#include <hpx/assertion.hpp>
+#include <hpx/config/asio.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Large messages may have their zero-copy chunks striped over several
+    // connections to the same destination. The primary connection carries
+    // the message header, the transmission chunks, the non-zero-copy data,
+    // and a stripe id, while the concatenated zero-copy data is split into
+    // contiguous ranges, each of which is sent over a separate (rail)
+    // connection prefixed by a stripe header.
+    //
+    // A stripe header has the same layout as a message header: the size
+    // field holds the number of payload bytes, the data size field holds the
+    // offset of the payload in the striped data, and the number of zero-copy
+    // chunks is set to stripe_marker. The header is followed by the stripe id.
+    constexpr std::uint32_t stripe_marker = 0xffffffff;
+
+    // flag set in the number of non-zero-copy chunks of a message header if
+    // its zero-copy chunks are striped
+    constexpr std::uint32_t striped_message_flag = 0x80000000;
+
+    // Generate an id identifying a striped message. The id has to be unique
+    // on the receiving side, the upper half holds the locality id of the
+    // sender to distinguish between senders.
+    inline std::uint64_t next_stripe_id(std::uint32_t locality_id)
+    {
+        static std::atomic<std::uint32_t> counter(0);
+        return (std::uint64_t(locality_id) << 32) | ++counter;
+    }
+
+    // Append buffers referring to the range [offset, offset + size) of the
+    // data described by the given buffer sequence.
+    template <typename Buffer>
+    void slice_buffers(std::vector<Buffer> const& buffers, std::size_t offset,
+        std::size_t size, std::vector<Buffer>& slice)
+    {
+        for (Buffer const& b : buffers)
+        {
+            if (size == 0)
+                break;
+
+            std::size_t buffer_size = boost::asio::buffer_size(b);
+            if (offset >= buffer_size)
+            {
+                offset -= buffer_size;
+                continue;
+            }
+
+            std::size_t n = (std::min)(buffer_size - offset, size);
+            slice.push_back(boost::asio::buffer(b + offset, n));
+
+            size -= n;
+            offset = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keeps track of striped messages which are being received. Stripes may
+    // arrive before the primary connection has registered the destination
+    // buffers for the message, in which case their data is held on to until
+    // the message is registered.
+    //
+    // If a stripe can't be received the whole message fails: the completion
+    // function is invoked with the error as soon as no other stripe is being
+    // received into the registered buffers anymore. The entry of a failed
+    // message is kept (without any data) until shutdown, so that stripes of
+    // the message which arrive later on are discarded.
+    class stripe_registry
+    {
+        typedef lcos::local::spinlock mutex_type;
+        typedef util::unique_function_nonser<
+                void(boost::system::error_code const&)
+            > completion_type;
+
+        struct entry
+        {
+            entry()
+              : registered_(false)
+              , failed_(false)
+              , remaining_(0)
+              , readers_(0)
+            {}
+
+            bool registered_;
+            bool failed_;
+            std::size_t remaining_;
+
+            // number of stripes currently being copied or received into the
+            // registered buffers
+            std::size_t readers_;
+
+            std::vector<boost::asio::mutable_buffer> targets_;
+            completion_type on_complete_;
+            boost::system::error_code error_;
+
+            // stripes received before the message was registered
+            std::vector<std::pair<std::size_t, std::vector<char>>> early_;
+        };
+
+        // The copy is done without holding the lock, the target buffers stay
+        // valid as the message can't complete before the copied data has
+        // been accounted for.
+        static void copy_stripe(
+            std::vector<boost::asio::mutable_buffer> const& slice,
+            std::vector<char> const& data)
+        {
+            std::size_t copied = boost::asio::buffer_copy(
+                slice, boost::asio::buffer(data));
+            HPX_ASSERT(copied == data.size());
+            HPX_UNUSED(copied);
+        }
+
+        // Hand out the completion function of a failed message if no stripe
+        // is being received into its buffers anymore, must be called with
+        // the lock held.
+        static completion_type take_failed_completion(entry& e)
+        {
+            HPX_ASSERT(e.failed_);
+            if (!e.registered_ || e.readers_ != 0)
+                return completion_type();
+
+            // keep the entry to discard stripes arriving later on
+            e.registered_ = false;
+            e.targets_.clear();
+            return std::move(e.on_complete_);
+        }
+
+    public:
+        HPX_NON_COPYABLE(stripe_registry);
+
+        stripe_registry() = default;
+
+        /// Register the buffers the striped data of a message is received
+        /// into. The given function is invoked as soon as all stripes have
+        /// arrived or one of them has failed (possibly from within this
+        /// function).
+        void register_message(std::uint64_t id,
+            std::vector<boost::asio::mutable_buffer>&& targets,
+            completion_type&& on_complete)
+        {
+            std::size_t total_size = boost::asio::buffer_size(targets);
+
+            std::vector<std::pair<std::size_t, std::vector<char>>> early;
+            std::vector<std::vector<boost::asio::mutable_buffer>> slices;
+
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                entry& e = entries_[id];
+                HPX_ASSERT(!e.registered_);
+
+                if (e.failed_)
+                {
+                    // a stripe of this message has failed already
+                    boost::system::error_code ec = e.error_;
+                    l.unlock();
+
+                    on_complete(ec);
+                    return;
+                }
+
+                if (total_size == 0)
+                {
+                    HPX_ASSERT(e.early_.empty());
+                    entries_.erase(id);
+                    l.unlock();
+
+                    on_complete(boost::system::error_code());
+                    return;
+                }
+
+                e.registered_ = true;
+                e.targets_ = std::move(targets);
+                e.remaining_ = total_size;
+                e.on_complete_ = std::move(on_complete);
+
+                std::swap(early, e.early_);
+                if (early.empty())
+                    return;
+
+                slices.resize(early.size());
+                for (std::size_t i = 0; i != early.size(); ++i)
+                {
+                    slice_buffers(e.targets_, early[i].first,
+                        early[i].second.size(), slices[i]);
+                }
+                ++e.readers_;
+            }
+
+            // copy the stripes which have arrived before the message was
+            // registered
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != early.size(); ++i)
+            {
+                copy_stripe(slices[i], early[i].second);
+                size += early[i].second.size();
+            }
+
+            stripe_received(id, size);
+        }
+
+        /// Retrieve the buffers the given range of a registered message has
+        /// to be received into, return false if the message is not
+        /// registered (yet). If true is returned, the stripe has to be
+        /// accounted for by calling either stripe_received or stripe_failed.
+        bool get_targets(std::uint64_t id, std::size_t offset,
+            std::size_t size, std::vector<boost::asio::mutable_buffer>& slice)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            auto it = entries_.find(id);
+            if (it == entries_.end() || !it->second.registered_ ||
+                it->second.failed_)
+            {
+                return false;
+            }
+
+            slice_buffers(it->second.targets_, offset, size, slice);
+            ++it->second.readers_;
+            return true;
+        }
+
+        /// Account for stripe data which was received directly into the
+        /// registered buffers.
+        void stripe_received(std::uint64_t id, std::size_t size)
+        {
+            completion_type on_complete;
+            boost::system::error_code ec;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                auto it = entries_.find(id);
+                HPX_ASSERT(it != entries_.end() && it->second.registered_);
+
+                entry& e = it->second;
+                HPX_ASSERT(e.readers_ != 0);
+                --e.readers_;
+
+                if (e.failed_)
+                {
+                    on_complete = take_failed_completion(e);
+                    ec = e.error_;
+                }
+                else
+                {
+                    HPX_ASSERT(e.remaining_ >= size);
+                    e.remaining_ -= size;
+                    if (e.remaining_ == 0)
+                    {
+                        HPX_ASSERT(e.readers_ == 0);
+                        on_complete = std::move(e.on_complete_);
+                        entries_.erase(it);
+                    }
+                }
+            }
+
+            if (on_complete)
+                on_complete(ec);
+        }
+
+        /// Hand over stripe data which was received into a temporary buffer
+        /// as the message was not registered at the time.
+        void add_stripe(std::uint64_t id, std::size_t offset,
+            std::vector<char>&& data)
+        {
+            HPX_ASSERT(!data.empty());
+
+            std::vector<boost::asio::mutable_buffer> slice;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                entry& e = entries_[id];
+                if (e.failed_)
+                    return;     // the message has failed, drop the data
+
+                if (!e.registered_)
+                {
+                    e.early_.emplace_back(offset, std::move(data));
+                    return;
+                }
+
+                slice_buffers(e.targets_, offset, data.size(), slice);
+                ++e.readers_;
+            }
+
+            // the message was registered while the data was being received
+            copy_stripe(slice, data);
+
+            stripe_received(id, data.size());
+        }
+
+        /// Report that a stripe of the given message could not be received,
+        /// direct has to be true if the stripe was being received into the
+        /// registered buffers (see get_targets).
+        void stripe_failed(std::uint64_t id, bool direct,
+            boost::system::error_code const& ec)
+        {
+            HPX_ASSERT(ec);
+
+            completion_type on_complete;
+            boost::system::error_code error;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                entry& e = entries_[id];
+                if (direct)
+                {
+                    HPX_ASSERT(e.readers_ != 0);
+                    --e.readers_;
+                }
+
+                if (!e.failed_)
+                {
+                    e.failed_ = true;
+                    e.error_ = ec;
+                    e.early_.clear();
+                }
+
+                on_complete = take_failed_completion(e);
+                error = e.error_;
+            }
+
+            if (on_complete)
+                on_complete(error);
+        }
+
+        /// Abort all messages which are still being received, the messages
+        /// are completed with operation_aborted as soon as no stripe is being
+        /// received into their buffers anymore.
+        void abort()
+        {
+            std::vector<completion_type> aborted;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                for (auto it = entries_.begin(); it != entries_.end(); /**/)
+                {
+                    entry& e = it->second;
+                    if (e.registered_ && e.readers_ != 0)
+                    {
+                        // the last pending stripe completes the message
+                        if (!e.failed_)
+                        {
+                            e.failed_ = true;
+                            e.error_ = boost::asio::error::operation_aborted;
+                            e.early_.clear();
+                        }
+                        ++it;
+                        continue;
+                    }
+
+                    if (e.registered_)
+                        aborted.push_back(std::move(e.on_complete_));
+                    it = entries_.erase(it);
+                }
+            }
+
+            boost::system::error_code const ec =
+                boost::asio::error::operation_aborted;
+            for (completion_type& on_complete : aborted)
+            {
+                on_complete(ec);
+            }
+        }
+
+    private:
+        mutex_type mtx_;
+        std::unordered_map<std::uint64_t, entry> entries_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -112,6 +112,8 @@ namespace hpx { namespace plugins
             fillini.emplace_back("async_serialization = ${HPX_PARCEL_" +
                 name_uc + "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("checksums = ${HPX_PARCEL_" + name_uc +
+                "_CHECKSUMS:$[hpx.parcel.checksums]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
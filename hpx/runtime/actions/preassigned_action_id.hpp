@@ -45,6 +45,7 @@ namespace hpx { namespace actions
         create_performance_counter_action_id,
         dijkstra_termination_action_id,
         free_component_action_id,
+        free_components_action_id,
         garbage_collect_action_id,
         get_config_action_id,
         hpx_get_locality_name_action_id,
@@ -102,6 +103,8 @@ namespace hpx { namespace actions
         symbol_namespace_unbind_action_id,
         symbol_namespace_iterate_action_id,
         symbol_namespace_on_event_action_id,
+        symbol_namespace_on_events_action_id,
+        symbol_namespace_invalidate_action_id,
         symbol_namespace_statistics_counter_action_id,
         terminate_action_id,
         terminate_all_action_id,
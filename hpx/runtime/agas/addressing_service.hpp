@@ -19,6 +19,7 @@
 #include <hpx/runtime/agas_fwd.hpp>
 #include <hpx/runtime/agas/gva.hpp>
 #include <hpx/runtime/agas/component_namespace.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
 #include <hpx/runtime/agas/locality_namespace.hpp>
 #include <hpx/runtime/agas/symbol_namespace.hpp>
 #include <hpx/runtime/agas/primary_namespace.hpp>
@@ -27,13 +28,14 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/util/interval_timer.hpp>
 #include <hpx/util_fwd.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -42,6 +44,8 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -73,34 +77,91 @@ public:
     // }}}
 
     // {{{ gva cache
-    struct gva_cache_key;
+    typedef detail::gva_cache_key gva_cache_key;
+    typedef detail::gva_cache gva_cache_type;
+    // }}}
 
-    typedef hpx::util::cache::lru_cache<
-        gva_cache_key
-      , gva
-      , hpx::util::cache::statistics::local_full_statistics
-    > gva_cache_type;
+    // {{{ symbol cache
+    typedef std::unordered_map<std::string, naming::id_type>
+        symbol_cache_type;
     // }}}
 
-    typedef std::set<naming::gid_type> migrated_objects_table_type;
+    typedef std::unordered_set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
     std::shared_ptr<gva_cache_type> gva_cache_;
 
-    mutable mutex_type migrated_objects_mtx_;
-    migrated_objects_table_type migrated_objects_table_;
+    // The table of migrated objects is distributed over a number of shards
+    // (selected by a hash of the id). The number of objects marked as
+    // migrated (or being marked) in a shard allows to skip locking the shard
+    // in the common case of none of its objects having been migrated.
+    // Readers which pin an object without locking the shard announce
+    // themselves in readers_ (only while size_ is zero), mark_as_migrated
+    // waits for those after having announced the object to be marked, see
+    // was_object_migrated. readers_ is modified by every reader, it is kept
+    // on its own cache line to not invalidate the line holding size_.
+    static constexpr std::size_t num_migrated_objects_shards = 64;
+
+    struct migrated_objects_shard
+    {
+        migrated_objects_shard()
+          : size_(0)
+        {
+        }
+
+        util::cache_line_data<std::atomic<std::size_t>> readers_;
+
+        mutex_type mtx_;
+        migrated_objects_table_type table_;
+        std::atomic<std::size_t> size_;
+    };
+
+    migrated_objects_shard& get_migrated_objects_shard(
+        naming::gid_type const& id);
+
+    std::array<util::cache_line_data<migrated_objects_shard>,
+        num_migrated_objects_shards> migrated_objects_;
+
+    // The ids resolved by on_symbol_namespace_events, an entry is removed
+    // by the symbol namespace instance managing the name when the name is
+    // unbound. The epoch is incremented by each invalidation, results
+    // which were requested before an invalidation are not cached.
+    mutable mutex_type symbol_cache_mtx_;
+    symbol_cache_type symbol_cache_;
+    std::uint64_t symbol_cache_epoch_;
 
     mutable mutex_type console_cache_mtx_;
     std::uint32_t console_cache_;
 
     std::size_t const max_refcnt_requests_;
 
+    // The pending reference count requests are distributed over a number
+    // of independently locked shards (selected by a hash of the id), this
+    // allows worker threads to accumulate requests without contending on a
+    // single lock. The requests are sent by the thread flushing the cache,
+    // refcnt_requests_mtx_ serializes the flushes.
+    static constexpr std::size_t num_refcnt_shards = 32;
+
+    struct refcnt_requests_shard
+    {
+        mutex_type mtx_;
+        refcnt_requests_type requests_;
+    };
+
+    refcnt_requests_shard& get_refcnt_shard(naming::gid_type const& id);
+
     mutex_type refcnt_requests_mtx_;
-    std::size_t refcnt_requests_count_;
-    bool enable_refcnt_caching_;
+    std::atomic<std::size_t> refcnt_requests_count_;
+    std::atomic<bool> enable_refcnt_caching_;
 
-    std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+    std::array<util::cache_line_data<refcnt_requests_shard>,
+        num_refcnt_shards> refcnt_shards_;
+
+    // periodically sends the pending requests (if enabled), the timer is
+    // started on the first decref request
+    std::int64_t const refcnt_flush_interval_;
+    std::atomic<bool> refcnt_flush_started_;
+    util::interval_timer refcnt_flush_timer_;
 
     service_mode const service_type;
     runtime_mode const runtime_type;
@@ -253,16 +314,39 @@ protected:
       , future<bool> f
         );
 
-    /// Maintain list of migrated objects
+    /// Maintain list of migrated objects, assumes that the mutex of the
+    /// given shard is locked.
     bool was_object_migrated_locked(
+        migrated_objects_shard& shard
+      , naming::gid_type const& id
+        );
+
+    /// Check whether the given object has been migrated (without pinning
+    /// it).
+    bool was_object_migrated_hint(
         naming::gid_type const& id
         );
 
 private:
-    /// Assumes that \a refcnt_requests_mtx_ is locked.
-    void send_refcnt_requests(
+    /// Add the given entry to the symbol cache unless the cache was
+    /// invalidated since the given epoch.
+    void update_symbol_cache(
+        std::string const& name
+      , naming::id_type const& id
+      , std::uint64_t epoch
+        );
+
+    /// Invoked by \a refcnt_flush_timer_, sends the pending requests.
+    bool flush_refcnt_requests();
+
+    /// Start \a refcnt_flush_timer_, if needed.
+    void start_refcnt_flush_timer();
+
+    /// Assumes that \a refcnt_requests_mtx_ is locked, moves the pending
+    /// requests from all shards into the given table.
+    void extract_refcnt_requests(
         std::unique_lock<mutex_type>& l
-      , error_code& ec = throws
+      , refcnt_requests_type& requests
         );
 
     /// Assumes that \a refcnt_requests_mtx_ is locked.
@@ -1343,6 +1427,26 @@ public:
     future<hpx::id_type> on_symbol_namespace_event(std::string const& name,
         bool call_for_past_events = false);
 
+    /// \brief Wait for the given names to be bound.
+    ///
+    /// This function is equivalent to invoking
+    /// on_symbol_namespace_event(name, true) for each of the given names,
+    /// except that all names managed by the same symbol namespace instance
+    /// are requested at once. The resolved ids are cached locally (if
+    /// caching is enabled) until the corresponding name is unbound.
+    ///
+    /// \param names      [in] The global names (strings) to resolve.
+    ///
+    /// \returns  A list of futures representing the ids bound to the given
+    ///           names (in the same order).
+    ///
+    std::vector<future<hpx::id_type> > on_symbol_namespace_events(
+        std::vector<std::string> const& names);
+
+    /// \warning This function is for internal use only. It is dangerous and
+    ///          may break your code if you use it.
+    void invalidate_symbol_cache(std::string const& name);
+
     /// \warning This function is for internal use only. It is dangerous and
     ///          may break your code if you use it.
     void update_cache_entry(
@@ -0,0 +1,306 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_AGAS_DETAIL_GVA_CACHE_HPP
+#define HPX_AGAS_DETAIL_GVA_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The key of an entry in the GVA cache, it covers the range of ids
+    // [gid, gid + count). A key for a single id compares equal to the key of
+    // a range containing it.
+    struct gva_cache_key
+    {    // {{{ gva_cache_key implementation
+    private:
+        typedef std::pair<naming::gid_type, naming::gid_type> key_type;
+
+        key_type key_;
+
+    public:
+        gva_cache_key()
+          : key_()
+        {
+        }
+
+        explicit gva_cache_key(
+                naming::gid_type const& id, std::uint64_t count = 1)
+          : key_(naming::detail::get_stripped_gid(id),
+                naming::detail::get_stripped_gid(id) + (count - 1))
+        {
+            HPX_ASSERT(count);
+        }
+
+        naming::gid_type get_gid() const
+        {
+            return key_.first;
+        }
+
+        naming::gid_type get_last_gid() const
+        {
+            return key_.second;
+        }
+
+        std::uint64_t get_count() const
+        {
+            naming::gid_type const size = key_.second - key_.first;
+            HPX_ASSERT(size.get_msb() == 0);
+            return size.get_lsb();
+        }
+
+        friend bool operator<(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            return lhs.key_.second < rhs.key_.first;
+        }
+
+        friend bool operator==(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            // Direct hit
+            if (lhs.key_ == rhs.key_)
+            {
+                return true;
+            }
+
+            // Is lhs in rhs?
+            if (1 == lhs.get_count() && 1 != rhs.get_count())
+            {
+                return rhs.key_.first <= lhs.key_.first &&
+                    lhs.key_.second <= rhs.key_.second;
+            }
+
+            // Is rhs in lhs?
+            else if (1 != lhs.get_count() && 1 == rhs.get_count())
+            {
+                return lhs.key_.first <= rhs.key_.first &&
+                    rhs.key_.second <= lhs.key_.second;
+            }
+
+            return false;
+        }
+    }; // }}}
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The client side cache of resolved global virtual addresses. The entries
+    // are distributed over a number of independently locked shards. Entries
+    // for single ids are stored in the shard selected by a hash of their id,
+    // entries covering a range of ids are split at the boundaries of blocks
+    // of 2^range_block_bits ids and each piece is stored in the shard
+    // selected by a hash of its block. Each shard evicts its entries using
+    // the CLOCK algorithm, i.e. a cache hit only marks the entry as
+    // referenced instead of reordering a list of entries.
+    //
+    // Components created in bulk receive consecutive ids and are placed at
+    // equidistant addresses, inserting the entry for an id directly
+    // following an entry for the same locality and component type extends
+    // that entry to a range (within the same block), if the range resolves
+    // the new id to the same address. A single entry then covers all of
+    // the components of a block. This can be disabled by passing false for
+    // combine_entries.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        typedef gva_cache_key key_type;
+        typedef gva entry_type;
+        typedef util::cache::statistics::local_full_statistics
+            statistics_type;
+        typedef lcos::local::spinlock mutex_type;
+
+        // ranges of ids are stored in pieces not crossing the boundaries of
+        // blocks of this many ids
+        static constexpr std::size_t range_block_bits = 10;
+
+        // ranges split into more pieces than this are not cached as a
+        // whole, only their first id is
+        static constexpr std::size_t max_range_pieces = 64;
+
+        // The number of shards is chosen based on the number of threads
+        // expected to access the cache concurrently (defaults to the
+        // number of cores).
+        explicit gva_cache(std::size_t max_size, std::size_t concurrency = 0,
+            bool combine_entries = true);
+
+        gva_cache(gva_cache const&) = delete;
+        gva_cache& operator=(gva_cache const&) = delete;
+
+        // the number of entries held by all shards
+        std::size_t size() const;
+
+        std::size_t capacity() const
+        {
+            return max_size_;
+        }
+
+        std::size_t num_shards() const
+        {
+            return shards_.size();
+        }
+
+        // change the maximum number of entries held by the cache
+        void reserve(std::size_t max_size);
+
+        // look up the entry covering the id referred to by the given key
+        bool get_entry(key_type const& key, key_type& realkey,
+            entry_type& entry);
+
+        // Insert or update the entry for the given key. An entry for a
+        // single id replaces a range resolving that id differently. Returns
+        // false if a range overlaps with a different entry already in the
+        // cache, in which case that entry is not replaced.
+        bool update(key_type const& key, entry_type const& entry);
+
+        // remove the entries covering the given id
+        void erase(naming::gid_type const& gid);
+
+        void clear();
+
+        // combine the statistics of all shards, f is invoked with the
+        // statistics_type instance of each shard and has to return the
+        // corresponding value
+        template <typename F>
+        std::int64_t get_statistics(F&& f)
+        {
+            std::int64_t result = 0;
+            for (std::unique_ptr<shard>& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_.data_);
+                result += static_cast<std::int64_t>(f(s->statistics_));
+            }
+            return result;
+        }
+
+    private:
+        struct slot
+        {
+            key_type key_;      // the key the entry was inserted with
+            entry_type entry_;
+            naming::gid_type first_;    // first id of the stored piece
+            bool used_;
+            bool referenced_;
+            bool range_;
+        };
+
+        // the pieces of ranges stored in a shard, sorted by their first id
+        struct range_index_entry
+        {
+            naming::gid_type first_;
+            naming::gid_type last_;
+            std::size_t slot_;
+        };
+
+        enum class range_match
+        {
+            none,           // no range covers the id
+            consistent,     // a range covers the id, resolving it the same
+            collision,      // a range covers the id, resolving it differently
+            extended        // the range preceding the id was extended
+        };
+
+        struct shard
+        {
+            shard()
+              : max_size_(1)
+              , hand_(0)
+              , num_ranges_(0)
+            {
+            }
+
+            bool get_single(naming::gid_type const& gid, key_type& realkey,
+                entry_type& entry);
+            bool get_range(naming::gid_type const& gid, key_type& realkey,
+                entry_type& entry);
+
+            bool replace_single(key_type const& key, entry_type const& entry);
+            void update_single(key_type const& key, entry_type const& entry);
+            range_match match_range(key_type const& key,
+                entry_type const& entry, bool extend);
+            bool update_range(key_type const& key, entry_type const& entry,
+                naming::gid_type const& first, naming::gid_type const& last);
+
+            // check whether the entry for gid can be combined with the entry
+            // for the following id into a range
+            bool combine_predecessor(naming::gid_type const& gid,
+                entry_type const& next, entry_type& combined);
+
+            // remove the entry for gid after it was combined into a range
+            void remove_single(naming::gid_type const& gid);
+            void erase_single(naming::gid_type const& gid);
+            bool erase_range(naming::gid_type const& gid, key_type& key);
+            void erase_piece(key_type const& key);
+
+            void clear();
+            void reserve(std::size_t max_size);
+
+            std::size_t size() const
+            {
+                return singles_.size() + ranges_.size();
+            }
+
+            std::vector<range_index_entry>::iterator find_range(
+                naming::gid_type const& gid);
+
+            void insert(key_type const& key, entry_type const& entry,
+                naming::gid_type const& first, naming::gid_type const& last,
+                bool range);
+            void remove(std::size_t pos);
+            void evict();
+
+            mutable util::cache_line_data<mutex_type> mtx_;
+
+            std::unordered_map<naming::gid_type, std::size_t> singles_;
+            std::vector<range_index_entry> ranges_;
+            std::vector<slot> slots_;
+            std::vector<std::size_t> free_slots_;
+
+            std::size_t max_size_;
+            std::size_t hand_;    // position of the CLOCK hand
+
+            // allows to skip locking the shard when looking up ranges
+            std::atomic<std::size_t> num_ranges_;
+
+            statistics_type statistics_;
+        };
+
+        shard& get_shard(naming::gid_type const& gid);
+        shard& get_range_shard(naming::gid_type const& gid);
+
+        // invoke f(shard, first, last) for each piece of the given range
+        template <typename F>
+        void for_each_piece(key_type const& key, F&& f);
+
+        bool update_single(key_type const& key, entry_type const& entry);
+        bool update_range(key_type const& key, entry_type const& entry);
+
+        // remove all pieces of the range covering the given id
+        void erase_range(naming::gid_type const& gid);
+
+        std::size_t shard_capacity(std::size_t max_size) const;
+
+        std::vector<std::unique_ptr<shard>> shards_;
+        std::size_t max_size_;
+        bool const combine_entries_;
+    };
+}}}
+
+#endif
@@ -300,6 +300,9 @@ HPX_API_EXPORT naming::id_type get_colocation_id(
 HPX_API_EXPORT hpx::future<hpx::id_type> on_symbol_namespace_event(
     std::string const& name, bool call_for_past_events);
 
+HPX_API_EXPORT std::vector<hpx::future<hpx::id_type>>
+    on_symbol_namespace_events(std::vector<std::string> const& names);
+
 ///////////////////////////////////////////////////////////////////////////////
 HPX_API_EXPORT hpx::future<std::pair<naming::id_type, naming::address>>
     begin_migration(naming::id_type const& id);
@@ -23,8 +23,10 @@
 #include <hpx/traits/action_message_handler.hpp>
 #include <hpx/traits/action_serialization_filter.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -33,6 +35,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -121,29 +124,73 @@ struct HPX_EXPORT primary_namespace
     typedef std::int32_t component_type;
 
     typedef std::pair<gva, naming::gid_type> gva_table_data_type;
-    typedef std::map<naming::gid_type, gva_table_data_type> gva_table_type;
-    typedef std::map<naming::gid_type, std::int64_t> refcnt_table_type;
+    typedef std::unordered_map<naming::gid_type, gva_table_data_type>
+        gva_table_type;
+    typedef std::map<naming::gid_type, gva_table_data_type>
+        gva_range_table_type;
+    typedef std::unordered_map<naming::gid_type, std::int64_t>
+        refcnt_table_type;
 
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
         resolved_type;
+
+    // number of independently locked parts of the tables
+    static constexpr std::size_t num_shards = 64;
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
-    mutex_type mutex_;
-
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::detail::condition_variable>
         > migration_table_type;
 
+    // The bindings of single ids, the reference counts and the objects being
+    // migrated are distributed over the shards based on a hash of the id.
+    // Bindings of ranges of ids are kept in a separate table which needs
+    // ordered lookups. Its lock is acquired only while already holding the
+    // lock of a shard (if any).
+    struct shard
+    {
+        mutex_type mutex_;
+        gva_table_type gvas_;
+        refcnt_table_type refcnts_;
+        migration_table_type migrating_objects_;
+    };
+
+    std::array<util::cache_line_data<shard>, num_shards> shards_;
+
+    util::cache_line_data<mutex_type> ranges_mutex_;
+    gva_range_table_type ranges_;
+    std::atomic<std::size_t> num_ranges_;
+
     std::string instance_name_;
     naming::gid_type next_id_;      // next available gid
     naming::gid_type locality_;     // our locality id
-    migration_table_type migrating_objects_;
+
+    static std::size_t get_shard_index(naming::gid_type const& id)
+    {
+        return std::hash<naming::gid_type>()(id) % num_shards;
+    }
+
+    shard& get_shard(naming::gid_type const& id)
+    {
+        return shards_[get_shard_index(id)].data_;
+    }
+
+    // A reference count update for a single id. The updates are applied
+    // grouped by shards to acquire the lock of each shard only once.
+    struct refcnt_update
+    {
+        std::size_t shard_;
+        naming::gid_type id_;
+        std::int64_t credits_;
+
+        friend bool operator<(
+            refcnt_update const& lhs, refcnt_update const& rhs)
+        {
+            return lhs.shard_ < rhs.shard_;
+        }
+    };
 
     struct update_time_on_exit;
 
@@ -222,13 +269,10 @@ struct HPX_EXPORT primary_namespace
     counter_data counter_data_;
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit count of the given id. Expects that \p l is locked.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
-      , naming::gid_type const& upper
+        shard& s
+      , naming::gid_type const& id
       , std::unique_lock<mutex_type>& l
       , const char* func_name
         );
@@ -241,7 +285,7 @@ struct HPX_EXPORT primary_namespace
 public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-      , mutex_()
+      , num_ranges_(0)
       , instance_name_()
       , next_id_(naming::invalid_gid)
       , locality_(naming::invalid_gid)
@@ -312,9 +356,7 @@ public:
         );
 
     void increment(
-        naming::gid_type const& lower
-      , naming::gid_type const& upper
-      , std::int64_t& credits
+        std::vector<refcnt_update>& updates
       , error_code& ec
         );
 
@@ -337,25 +379,20 @@ public:
 
     void resolve_free_list(
         std::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+      , shard& s
+      , std::list<naming::gid_type> const& free_list
       , free_entry_list_type& free_entry_list
-      , naming::gid_type const& lower
-      , naming::gid_type const& upper
       , error_code& ec
         );
 
     void decrement_sweep(
         free_entry_list_type& free_list
-      , naming::gid_type const& lower
-      , naming::gid_type const& upper
-      , std::int64_t credits
+      , std::vector<refcnt_update>& updates
       , error_code& ec
         );
 
     void free_components_sync(
         free_entry_list_type& free_list
-      , naming::gid_type const& lower
-      , naming::gid_type const& upper
       , error_code& ec
         );
 
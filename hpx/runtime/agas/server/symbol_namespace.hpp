@@ -16,11 +16,16 @@
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/local_lcos/promise.hpp>
 
 #include <atomic>
 #include <cstdint>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -51,6 +56,27 @@ struct HPX_EXPORT symbol_namespace
         gid_table_type;
 
     typedef std::multimap<std::string, hpx::id_type> on_event_data_map_type;
+
+    // the localities subscribed to a name and the position of the name in
+    // the order of subscription
+    struct cache_subscription
+    {
+        std::set<std::uint32_t> localities_;
+        std::list<std::string>::iterator order_;
+    };
+
+    typedef std::map<std::string, cache_subscription> cache_subscribers_type;
+
+    // a subscription removed to make room, its invalidation is pending
+    struct evicted_subscription
+    {
+        std::string key_;
+        std::set<std::uint32_t> localities_;
+        std::shared_ptr<lcos::local::promise<void> > done_;
+    };
+
+    typedef std::multimap<std::string, hpx::shared_future<void> >
+        pending_invalidations_type;
     // }}}
 
   private:
@@ -59,6 +85,35 @@ struct HPX_EXPORT symbol_namespace
     std::string instance_name_;
     on_event_data_map_type on_event_data_;
 
+    // the localities which may have cached the id bound to a name (see
+    // on_events), their caches are invalidated when the name is unbound.
+    // At most HPX_AGAS_MAX_SYMBOL_CACHE_SUBSCRIPTIONS names are tracked, the
+    // caches of the oldest subscription are invalidated to make room.
+    cache_subscribers_type cache_subscribers_;
+    std::list<std::string> cache_subscription_order_;
+
+    // the invalidations which have been started but not yet acknowledged,
+    // a name is bound anew only after all of its cached entries are gone
+    pending_invalidations_type pending_invalidations_;
+
+    // record an invalidation for the given name, the returned promise is
+    // fulfilled by invalidate_caches (must be called with mutex_ held)
+    std::shared_ptr<lcos::local::promise<void> > add_pending_invalidation(
+        std::string const& key
+        );
+
+    // send the invalidation requests without waiting for them
+    void invalidate_caches(
+        std::string const& key
+      , std::set<std::uint32_t> const& localities
+      , std::shared_ptr<lcos::local::promise<void> > done
+        );
+
+    void wait_for_invalidation(
+        std::unique_lock<mutex_type>& l
+      , std::string const& key
+        );
+
     // data structure holding all counters for the omponent_namespace component
     struct counter_data
     {
@@ -162,6 +217,18 @@ struct HPX_EXPORT symbol_namespace
       , hpx::id_type lco
         );
 
+    // Resolve all of the given names at once. The names which are not bound
+    // yet are handled like on_event(name, true, lco) for the corresponding
+    // lco, an invalid gid is returned for them. The locality of each lco is
+    // recorded as a subscriber for the invalidation of the name.
+    std::vector<naming::gid_type> on_events(
+        std::vector<std::string> const& names
+      , std::vector<hpx::id_type> const& lcos
+        );
+
+    // remove the given name from the symbol cache of this locality
+    void invalidate(std::string const& key);
+
     naming::gid_type statistics_counter(std::string const& key);
 
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind);
@@ -169,6 +236,8 @@ struct HPX_EXPORT symbol_namespace
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind);
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate);
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event);
+    HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_events);
+    HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, invalidate);
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, statistics_counter);
 };
 
@@ -209,6 +278,17 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::on_event_action,
     symbol_namespace_on_event_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::on_events_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::on_events_action,
+    symbol_namespace_on_events_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::symbol_namespace::statistics_counter_action)
 
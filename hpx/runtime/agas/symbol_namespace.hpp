@@ -76,6 +76,12 @@ struct symbol_namespace
       , hpx::id_type lco
         );
 
+    // all names have to be managed by the same symbol namespace instance
+    hpx::future<std::vector<naming::id_type> > on_events(
+        std::vector<std::string> names
+      , std::vector<hpx::id_type> lcos
+        );
+
     hpx::future<iterate_names_return_type> iterate_async(
         std::string const& pattern) const;
     iterate_names_return_type iterate(std::string const& pattern) const;
@@ -0,0 +1,445 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file communication_distribution_policy.hpp
+
+#if !defined(HPX_COMPONENTS_COMMUNICATION_DISTRIBUTION_POLICY_HPP)
+#define HPX_COMPONENTS_COMMUNICATION_DISTRIBUTION_POLICY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/functional/bind_back.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/components/binpacking_distribution_policy.hpp>
+#include <hpx/runtime/components/component_type.hpp>
+#include <hpx/runtime/components/migrate_component.hpp>
+#include <hpx/runtime/components/stubs/stub_base.hpp>
+#include <hpx/runtime/find_here.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/traits/is_component.hpp>
+#include <hpx/traits/is_distribution_policy.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components
+{
+    /// The name of the parcelport whose counters are used by default, an
+    /// empty name selects the parcelport the parcel handler sends parcels
+    /// with (the enabled parcelport with the highest priority).
+    static char const* const default_communication_parcelport = "";
+
+    /// The default cost of sending one parcel, expressed as the number of
+    /// bytes which could have been transferred in the same time (this
+    /// roughly corresponds to 1us of latency on a 10 GBit/s network).
+    static std::uint64_t const default_communication_parcel_cost = 1250;
+
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Retrieve the cost of the traffic generated by the given action on
+        // each of the localities since the previous call for the same action
+        // and parcelport, this is zero for all localities if the
+        // corresponding counters are not available.
+        HPX_EXPORT hpx::future<std::vector<std::uint64_t> >
+        get_communication_costs(std::string const& action_name,
+            std::string const& parcelport, std::uint64_t parcel_cost,
+            std::vector<hpx::id_type> const& localities);
+
+        // the locality generating the most traffic for the action, if there
+        // is no traffic, the locality with the fewest instances
+        HPX_EXPORT std::size_t get_communication_partner(
+            std::vector<std::uint64_t> const& costs,
+            std::vector<std::uint64_t> const& instances);
+
+        // distribute the objects proportionally to the traffic generated by
+        // each of the localities, if there is no traffic, distribute them
+        // such that the number of instances is balanced
+        HPX_EXPORT std::vector<std::size_t> get_communication_items_count(
+            std::size_t count, std::vector<std::uint64_t> const& costs,
+            std::vector<std::uint64_t> const& instances);
+
+        HPX_EXPORT hpx::future<hpx::id_type> get_communication_target(
+            std::string const& component_name, std::string const& action_name,
+            std::string const& parcelport, std::uint64_t parcel_cost,
+            std::vector<hpx::id_type> const& localities);
+
+        template <typename Component>
+        struct create_communication_helper
+        {
+            template <typename ...Ts>
+            hpx::future<hpx::id_type> operator()(
+                hpx::future<hpx::id_type> && target, Ts&&... vs) const
+            {
+                return stub_base<Component>::create_async(
+                    target.get(), std::forward<Ts>(vs)...);
+            }
+        };
+
+        template <typename Component>
+        struct create_communication_bulk_helper
+        {
+            typedef std::pair<hpx::id_type, std::vector<hpx::id_type> >
+                bulk_locality_result;
+
+            create_communication_bulk_helper(
+                    std::vector<hpx::id_type> const& localities)
+              : localities_(localities)
+            {}
+
+            template <typename ...Ts>
+            hpx::future<std::vector<bulk_locality_result> >
+            operator()(hpx::future<std::vector<std::uint64_t> > && costs,
+                hpx::future<std::vector<std::uint64_t> > && instances,
+                std::size_t count, Ts const&... vs) const
+            {
+                std::vector<std::size_t> to_create =
+                    get_communication_items_count(
+                        count, costs.get(), instances.get());
+
+                std::vector<hpx::future<std::vector<hpx::id_type> > > objs;
+                objs.reserve(localities_.size());
+
+                for (std::size_t i = 0; i != to_create.size(); ++i)
+                {
+                    objs.push_back(stub_base<Component>::bulk_create_async(
+                        localities_[i], to_create[i], vs...));
+                }
+
+                // consolidate all results
+                std::vector<hpx::id_type> const& localities = localities_;
+                return hpx::dataflow(hpx::launch::sync,
+                    [localities](
+                        std::vector<hpx::future<std::vector<hpx::id_type> > >
+                            && v
+                    ) -> std::vector<bulk_locality_result>
+                    {
+                        HPX_ASSERT(localities.size() == v.size());
+
+                        std::vector<bulk_locality_result> result;
+                        result.reserve(v.size());
+
+                        for (std::size_t i = 0; i != v.size(); ++i)
+                        {
+                            result.emplace_back(localities[i], v[i].get());
+                        }
+                        return result;
+                    },
+                    std::move(objs));
+            }
+
+            std::vector<hpx::id_type> localities_;
+        };
+        /// \endcond
+    }
+
+    /// This class specifies the parameters for a distribution policy placing
+    /// new objects close to the localities communicating with them. The
+    /// policy is associated with an action (usually the action most
+    /// frequently invoked on the new objects) and uses the per-action
+    /// parcel counters (/parcels/count/<parcelport>/sent@<action> and
+    /// /serialize/count/<parcelport>/sent@<action>) to determine how much
+    /// traffic each of the localities generates for this action. The cost
+    /// of the traffic of a locality is the number of bytes it has sent plus
+    /// the number of parcels it has sent multiplied by the cost of a single
+    /// parcel (which models the latency of a message). Only the traffic
+    /// generated since the previous placement for the same action is taken
+    /// into account, older traffic does not influence later placements.
+    ///
+    /// Single objects are created on the locality with the highest traffic
+    /// cost, multiple objects are distributed proportionally to the traffic
+    /// costs. If no traffic has been recorded (or if HPX was built without
+    /// HPX_WITH_PARCELPORT_ACTION_COUNTERS), the objects are distributed
+    /// like the \a binpacking_distribution_policy does.
+    ///
+    /// Existing objects can be moved to the locality with the highest
+    /// traffic cost using hpx::components::migrate.
+    struct communication_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a
+        /// \a communication_distribution_policy. This policy will represent
+        /// one locality (the local locality).
+        communication_distribution_policy()
+          : parcelport_(default_communication_parcelport)
+          , parcel_cost_(default_communication_parcel_cost)
+        {}
+
+        /// Create a new \a communication_distribution_policy representing
+        /// the given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param action_name [in] The name of the action whose traffic
+        ///                 should be used as the distribution criteria
+        /// \param parcel_cost [in] The cost of sending a single parcel,
+        ///                 expressed in bytes
+        /// \param parcelport [in] The name of the parcelport whose counters
+        ///                 should be used, by default the parcelport parcels
+        ///                 are sent with
+        ///
+        communication_distribution_policy operator()(
+            std::vector<id_type> const& locs, std::string const& action_name,
+            std::uint64_t parcel_cost = default_communication_parcel_cost,
+            char const* parcelport = default_communication_parcelport) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc: locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return communication_distribution_policy(
+                locs, action_name, parcel_cost, parcelport);
+        }
+
+        /// Create a new \a communication_distribution_policy representing
+        /// the given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param parcel_cost [in] The cost of sending a single parcel,
+        ///                 expressed in bytes
+        /// \param parcelport [in] The name of the parcelport whose counters
+        ///                 should be used, by default the parcelport parcels
+        ///                 are sent with
+        ///
+        /// \tparam Action  The action whose traffic should be used as the
+        ///                 distribution criteria
+        ///
+        template <typename Action>
+        communication_distribution_policy for_action(
+            std::vector<id_type> const& locs,
+            std::uint64_t parcel_cost = default_communication_parcel_cost,
+            char const* parcelport = default_communication_parcelport) const
+        {
+            return (*this)(locs, actions::detail::get_action_name<Action>(),
+                parcel_cost, parcelport);
+        }
+
+        /// Create one object on the locality associated with this policy
+        /// instance which generates the most traffic for the associated
+        /// action
+        ///
+        /// \param vs  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename ...Ts>
+        hpx::future<hpx::id_type> create(Ts&&... vs) const
+        {
+            using components::stub_base;
+
+            // handle special cases
+            if (localities_.size() <= 1)
+            {
+                return stub_base<Component>::create_async(
+                    localities_.empty() ? hpx::find_here() : localities_[0],
+                    std::forward<Ts>(vs)...);
+            }
+
+            return get_next_target_async<Component>().then(
+                hpx::util::bind_back(
+                    detail::create_communication_helper<Component>(),
+                    std::forward<Ts>(vs)...));
+        }
+
+        /// \cond NOINTERNAL
+        typedef std::pair<hpx::id_type, std::vector<hpx::id_type> >
+            bulk_locality_result;
+        /// \endcond
+
+        /// Create multiple objects on the localities associated by
+        /// this policy instance
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename ...Ts>
+        hpx::future<std::vector<bulk_locality_result> >
+        bulk_create(std::size_t count, Ts&&... vs) const
+        {
+            using components::stub_base;
+
+            if (localities_.size() > 1)
+            {
+                hpx::future<std::vector<std::uint64_t> > costs =
+                    detail::get_communication_costs(action_name_,
+                        parcelport_, parcel_cost_, localities_);
+                hpx::future<std::vector<std::uint64_t> > instances =
+                    detail::get_counter_values(
+                        get_component_name<Component>(),
+                        default_binpacking_counter_name, localities_);
+
+                return hpx::dataflow(
+                    detail::create_communication_bulk_helper<Component>(
+                        localities_),
+                    std::move(costs), std::move(instances), count,
+                    std::forward<Ts>(vs)...);
+            }
+
+            // handle special cases
+            hpx::id_type id =
+                localities_.empty() ? hpx::find_here() : localities_.front();
+
+            hpx::future<std::vector<hpx::id_type> > f =
+                stub_base<Component>::bulk_create_async(
+                    id, count, std::forward<Ts>(vs)...);
+
+            return f.then(hpx::launch::sync,
+                [id = std::move(id)](
+                    hpx::future<std::vector<hpx::id_type> > && f
+                ) -> std::vector<bulk_locality_result>
+                {
+                    std::vector<bulk_locality_result> result;
+                    result.emplace_back(id, f.get());
+                    return result;
+                });
+        }
+
+        /// Returns a future referring to the locality associated with this
+        /// policy instance which generates the most traffic for the
+        /// associated action.
+        template <typename Component>
+        hpx::future<hpx::id_type> get_next_target_async() const
+        {
+            if (localities_.size() <= 1)
+            {
+                return hpx::make_ready_future(
+                    localities_.empty() ? hpx::find_here() : localities_[0]);
+            }
+
+            return detail::get_communication_target(
+                get_component_name<Component>(), action_name_, parcelport_,
+                parcel_cost_, localities_);
+        }
+
+        /// Returns the name of the action associated with this policy
+        /// instance.
+        std::string const& get_action_name() const
+        {
+            return action_name_;
+        }
+
+        /// Returns the cost of sending a single parcel (in bytes) used by
+        /// this policy instance.
+        std::uint64_t get_parcel_cost() const
+        {
+            return parcel_cost_;
+        }
+
+        /// Returns the number of associated localities for this distribution
+        /// policy
+        ///
+        /// \note This function is part of the creation policy implemented by
+        ///       this class
+        ///
+        std::size_t get_num_localities() const
+        {
+            return localities_.size();
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        communication_distribution_policy(
+                std::vector<id_type> const& localities,
+                std::string const& action_name, std::uint64_t parcel_cost,
+                char const* parcelport)
+          : localities_(localities)
+          , action_name_(action_name)
+          , parcelport_(parcelport)
+          , parcel_cost_(parcel_cost)
+        {}
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            ar & localities_ & action_name_ & parcelport_ & parcel_cost_;
+        }
+
+        std::vector<id_type> localities_;   // localities to create things on
+        std::string action_name_;           // action whose traffic is used
+        std::string parcelport_;            // parcelport whose counters are used
+        std::uint64_t parcel_cost_;         // cost of a parcel in bytes
+        /// \endcond
+    };
+
+    /// A predefined instance of the communication \a distribution_policy. It
+    /// will represent the local locality and will place all items to create
+    /// here.
+    static communication_distribution_policy const communication_aware;
+
+    /// Migrate the given component to the locality associated with the
+    /// given policy which generates the most traffic for the action
+    /// associated with the policy.
+    ///
+    /// \param to_migrate      [in] The client side representation of the
+    ///                        component to migrate.
+    /// \param policy          [in] The policy used to determine the locality
+    ///                        to migrate this object to.
+    ///
+    /// \tparam  Component     Specifies the component type of the
+    ///                        component to migrate.
+    ///
+    /// \returns A future representing the global id of the migrated
+    ///          component instance. This should be the same as \a migrate_to.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<naming::id_type>
+#else
+    inline typename std::enable_if<
+        traits::is_component<Component>::value, future<naming::id_type>
+    >::type
+#endif
+    migrate(naming::id_type const& to_migrate,
+        communication_distribution_policy const& policy)
+    {
+        return policy.get_next_target_async<Component>().then(
+            [to_migrate](hpx::future<hpx::id_type> && target)
+            {
+                return migrate<Component>(to_migrate, target.get());
+            });
+    }
+}}
+
+/// \cond NOINTERNAL
+namespace hpx
+{
+    using hpx::components::communication_distribution_policy;
+    using hpx::components::communication_aware;
+
+    namespace traits
+    {
+        template <>
+        struct is_distribution_policy<
+                components::communication_distribution_policy>
+          : std::true_type
+        {};
+    }
+}
+/// \endcond
+
+#endif
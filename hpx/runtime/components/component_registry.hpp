@@ -103,6 +103,7 @@ namespace hpx { namespace components
             }
             components::enabled(type) = enabled;
             components::deleter(type) = &server::destroy<Component>;
+            components::bulk_deleter(type) = &server::destroy_bulk<Component>;
         }
     };
 }}
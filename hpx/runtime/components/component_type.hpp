@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace components
@@ -95,6 +96,12 @@ namespace hpx { namespace components
         hpx::naming::gid_type const&, hpx::naming::address const&);
     HPX_EXPORT component_deleter_type& deleter(component_type type);
 
+    // destroys a number of local instances of the same component type at once
+    typedef void(*component_bulk_deleter_type)(
+        std::vector<hpx::naming::gid_type> const&,
+        std::vector<hpx::naming::address> const&);
+    HPX_EXPORT component_bulk_deleter_type& bulk_deleter(component_type type);
+
     HPX_EXPORT bool enumerate_instance_counts(
         util::unique_function_nonser<bool(component_type)> const& f);
 
@@ -14,8 +14,13 @@
 #include <hpx/runtime/components/server/component_heap.hpp>
 #include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/util/one_size_heap_list.hpp>
 
+#include <cstddef>
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace components { namespace server
@@ -23,6 +28,44 @@ namespace hpx { namespace components { namespace server
     HPX_EXPORT void destroy_component(naming::gid_type const& gid,
         naming::address const& addr);
 
+    // Destroy all of the given components. Components located on other
+    // localities are destroyed by sending a single request to each of these
+    // localities instead of one request per component, local components of
+    // the same type are destroyed at once (see destroy_bulk).
+    HPX_EXPORT void destroy_components(std::vector<naming::gid_type> gids,
+        std::vector<naming::address> addrs);
+
+    namespace detail
+    {
+        // heaps based on one_size_heap_list release the slots of a number
+        // of instances at once, other heaps release them one by one
+        template <typename Heap>
+        void free_components(
+            Heap& heap, std::vector<void*>&& storage, std::true_type)
+        {
+            heap.free_bulk(std::move(storage));
+        }
+
+        template <typename Heap>
+        void free_components(
+            Heap& heap, std::vector<void*>&& storage, std::false_type)
+        {
+            for (void* p : storage)
+            {
+                heap.free(p, 1);
+            }
+        }
+
+        template <typename Component>
+        void free_components(std::vector<void*>&& storage)
+        {
+            using heap_type = typename Component::heap_type;
+            free_components(component_heap<Component>(), std::move(storage),
+                typename std::is_base_of<util::one_size_heap_list,
+                    heap_type>::type());
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Component>
     void destroy(naming::gid_type const& gid, naming::address const& addr)
@@ -61,6 +104,59 @@ namespace hpx { namespace components { namespace server
         component_heap<Component>().free(c, 1);
     }
 
+    // Destroy a number of local instances of the same component type, the
+    // heap slots of all of them are released at once.
+    template <typename Component>
+    void destroy_bulk(std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs)
+    {
+        HPX_ASSERT(gids.size() == addrs.size());
+
+        // make sure all of the instances are of the correct component type
+        // before any of them is destroyed
+        components::component_type type =
+            components::get_component_type<typename Component::wrapped_type>();
+        for (std::size_t i = 0; i != gids.size(); ++i)
+        {
+            if (!types_are_compatible(type, addrs[i].type_))
+            {
+                std::ostringstream strm;
+                strm << "global id " << gids[i] << " is not bound to a "
+                        "component instance of type: "
+                     << get_component_type_name(type) << " (it is bound to a "
+                     << get_component_type_name(addrs[i].type_) << ")";
+                HPX_THROW_EXCEPTION(hpx::unknown_component_address,
+                    "destroy_bulk<Component>", strm.str());
+                return;
+            }
+        }
+
+        std::vector<void*> storage;
+        storage.reserve(gids.size());
+
+        naming::gid_type const here = get_locality();
+        for (std::size_t i = 0; i != gids.size(); ++i)
+        {
+            // This component might have been migrated, find out where it is
+            // and instruct that locality to delete it.
+            if (here != addrs[i].locality_)
+            {
+                destroy_component(gids[i], addrs[i]);
+                continue;
+            }
+
+            --instance_count(type);
+
+            // delete the local instances
+            Component* c = reinterpret_cast<Component*>(addrs[i].address_);
+            c->finalize();
+            c->~Component();
+            storage.push_back(c);
+        }
+
+        detail::free_components<Component>(std::move(storage));
+    }
+
     template <typename Component>
     void destroy(naming::gid_type const& gid)
     {
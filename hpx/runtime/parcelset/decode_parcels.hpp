@@ -17,6 +17,7 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_checksums.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/serialization/serialize.hpp>
@@ -126,11 +127,28 @@ namespace hpx { namespace parcelset
                 performance_counters::parcels::data_point& data =
                     buffer.data_point_;
 
+                if (pp.checksums_enabled())
+                {
+                    std::int64_t bytes_verified =
+                        detail::verify_checksums(buffer, chunks);
+                    if (bytes_verified < 0)
+                    {
+                        pp.add_checksum_failure();
+                        HPX_THROW_EXCEPTION(serialization_error,
+                            "hpx::parcelset::decode_message",
+                            "the received message is corrupted (checksum "
+                            "mismatch)");
+                    }
+                    pp.add_checksum_verified(
+                        static_cast<std::size_t>(bytes_verified));
+                }
+
                 {
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
                         inbound_data_size, &chunks);
+                    archive.enable_direct_reads();
 
                     if(parcel_count == 0)
                     {
@@ -0,0 +1,199 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_BUFFER_POOL_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_BUFFER_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A pool of pre-sized parcel buffers which are recycled between outgoing
+    // messages. Buffers are kept in power-of-two size classes (based on the
+    // capacity of their data vector), each of which is protected by its own
+    // spinlock. Buffers which are larger than the largest size class are not
+    // kept in the pool to avoid pinning large amounts of memory.
+    template <typename ParcelBuffer>
+    class parcel_buffer_pool
+    {
+    public:
+        HPX_NON_COPYABLE(parcel_buffer_pool);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        // smallest size class is 4kB, largest possible one is 1GB
+        static constexpr std::size_t min_size_class_log2 = 12;
+        static constexpr std::size_t num_size_classes = 19;
+
+        struct size_class
+        {
+            size_class() = default;
+
+            mutex_type mtx_;
+            std::vector<ParcelBuffer> buffers_;
+        };
+
+        static std::size_t size_class_floor(std::size_t size)
+        {
+            std::size_t log2 = 0;
+            while ((size >>= 1) != 0)
+                ++log2;
+            return log2 < min_size_class_log2 ? 0 : log2 - min_size_class_log2;
+        }
+
+        static std::size_t size_class_ceil(std::size_t size)
+        {
+            std::size_t idx = size_class_floor(size);
+            if (size > (std::size_t(1) << (idx + min_size_class_log2)))
+                ++idx;
+            return idx;
+        }
+
+    public:
+        static constexpr std::size_t default_max_cached = 16;
+        static constexpr std::size_t default_max_buffer_size = 16 * 1024 * 1024;
+
+        explicit parcel_buffer_pool(
+                std::size_t max_cached = default_max_cached,
+                std::size_t max_buffer_size = default_max_buffer_size)
+          : max_cached_(max_cached)
+          , max_size_class_(size_class_floor(max_buffer_size))
+          , hits_(0), misses_(0)
+        {
+            if (max_size_class_ >= num_size_classes)
+                max_size_class_ = num_size_classes - 1;
+        }
+
+        /// Return a buffer whose data vector is able to hold at least
+        /// \a size_hint bytes without reallocation. Buffers are taken from the
+        /// smallest non-empty size class which satisfies the request.
+        ParcelBuffer get(std::size_t size_hint = 0)
+        {
+            std::size_t idx = size_class_ceil(size_hint);
+            for (std::size_t i = idx; i <= max_size_class_; ++i)
+            {
+                size_class& c = size_classes_[i];
+
+                std::unique_lock<mutex_type> l(c.mtx_, std::try_to_lock);
+                if (!l.owns_lock() || c.buffers_.empty())
+                    continue;
+
+                ParcelBuffer buffer(std::move(c.buffers_.back()));
+                c.buffers_.pop_back();
+                l.unlock();
+
+                ++hits_;
+                return buffer;
+            }
+
+            ++misses_;
+
+            // nothing suitable cached, allocate the full size class at once
+            ParcelBuffer buffer;
+            if (idx <= max_size_class_)
+            {
+                buffer.data_.reserve(
+                    std::size_t(1) << (idx + min_size_class_log2));
+            }
+            else
+            {
+                buffer.data_.reserve(size_hint);
+            }
+            return buffer;
+        }
+
+        /// Hand a buffer back to the pool. The buffer is cleared while
+        /// retaining its allocated storage. Buffers which are too small, too
+        /// large, or which would overflow their size class are released.
+        void reclaim(ParcelBuffer&& buffer)
+        {
+            std::size_t capacity = buffer.data_.capacity();
+            if (capacity < (std::size_t(1) << min_size_class_log2))
+                return;
+
+            std::size_t idx = size_class_floor(capacity);
+            if (idx > max_size_class_)
+                return;
+
+            buffer.clear();
+
+            size_class& c = size_classes_[idx];
+            std::lock_guard<mutex_type> l(c.mtx_);
+            if (c.buffers_.size() < max_cached_)
+                c.buffers_.push_back(std::move(buffer));
+        }
+
+        /// Return whether a buffer of the given capacity would be accepted by
+        /// \a reclaim.
+        bool is_poolable(std::size_t capacity) const
+        {
+            return size_class_floor(capacity) <= max_size_class_;
+        }
+
+        std::size_t hits(bool reset)
+        {
+            return reset ? hits_.exchange(0) : hits_.load();
+        }
+
+        std::size_t misses(bool reset)
+        {
+            return reset ? misses_.exchange(0) : misses_.load();
+        }
+
+        /// Return the given statistic, used for the performance counters
+        std::int64_t get_statistics(
+            buffer_pool_statistics_type t, bool reset)
+        {
+            switch (t)
+            {
+            case buffer_pool_hits:
+                return std::int64_t(hits(reset));
+
+            case buffer_pool_misses:
+                return std::int64_t(misses(reset));
+
+            default:
+                break;
+            }
+            return 0;
+        }
+
+    private:
+        std::size_t max_cached_;
+        std::size_t max_size_class_;
+        std::array<size_class, num_size_classes> size_classes_;
+
+        std::atomic<std::size_t> hits_;
+        std::atomic<std::size_t> misses_;
+    };
+
+    template <typename ParcelBuffer>
+    constexpr std::size_t parcel_buffer_pool<ParcelBuffer>::min_size_class_log2;
+    template <typename ParcelBuffer>
+    constexpr std::size_t parcel_buffer_pool<ParcelBuffer>::num_size_classes;
+    template <typename ParcelBuffer>
+    constexpr std::size_t parcel_buffer_pool<ParcelBuffer>::default_max_cached;
+    template <typename ParcelBuffer>
+    constexpr std::size_t
+        parcel_buffer_pool<ParcelBuffer>::default_max_buffer_size;
+}}}
+
+#endif
+#endif
@@ -0,0 +1,119 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_CHECKSUMS_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_CHECKSUMS_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/hashing/crc32c.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/util/integer/endian.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    // If checksums are enabled, the data of a message is followed by a
+    // trailer of CRC-32C checksums: one for each zero-copy chunk (in the
+    // order of the chunks), followed by one covering all of the data in
+    // front of it (including the checksums of the chunks).
+    using checksum_type = util::integer::ulittle32_t;
+
+    inline std::size_t checksum_trailer_size(std::size_t num_zero_copy_chunks)
+    {
+        return sizeof(checksum_type) * (num_zero_copy_chunks + 1);
+    }
+
+    inline std::size_t count_zero_copy_chunks(
+        std::vector<serialization::serialization_chunk> const& chunks)
+    {
+        std::size_t count = 0;
+        for (serialization::serialization_chunk const& c : chunks)
+        {
+            if (c.type_ == serialization::chunk_type_pointer)
+                ++count;
+        }
+        return count;
+    }
+
+    template <typename Buffer>
+    void append_checksums(Buffer& buffer)
+    {
+        std::size_t size = buffer.data_.size();
+        buffer.data_.resize(
+            size + checksum_trailer_size(count_zero_copy_chunks(buffer.chunks_)));
+
+        char* trailer = buffer.data_.data() + size;
+        for (serialization::serialization_chunk const& c : buffer.chunks_)
+        {
+            if (c.type_ != serialization::chunk_type_pointer)
+                continue;
+
+            checksum_type crc(util::crc32c(c.data_.cpos_, c.size_));
+            std::memcpy(trailer, &crc, sizeof(checksum_type));
+            trailer += sizeof(checksum_type);
+        }
+
+        checksum_type crc(util::crc32c(buffer.data_.data(),
+            static_cast<std::size_t>(trailer - buffer.data_.data())));
+        std::memcpy(trailer, &crc, sizeof(checksum_type));
+    }
+
+    // Verify the checksums of a received message and strip them from its
+    // data. Returns the number of verified bytes or -1 if the verification
+    // failed.
+    template <typename Buffer>
+    std::int64_t verify_checksums(Buffer& buffer,
+        std::vector<serialization::serialization_chunk> const& chunks)
+    {
+        std::size_t size = buffer.data_.size();
+        std::size_t trailer_size =
+            checksum_trailer_size(count_zero_copy_chunks(chunks));
+        if (size < trailer_size)
+            return -1;
+
+        char const* data = buffer.data_.data();
+        std::size_t checked_size = size - sizeof(checksum_type);
+
+        checksum_type expected;
+        std::memcpy(&expected, data + checked_size, sizeof(checksum_type));
+        if (util::crc32c(data, checked_size) !=
+            static_cast<std::uint32_t>(expected))
+        {
+            return -1;
+        }
+
+        std::int64_t bytes_verified = static_cast<std::int64_t>(size);
+
+        char const* trailer = data + size - trailer_size;
+        for (serialization::serialization_chunk const& c : chunks)
+        {
+            if (c.type_ != serialization::chunk_type_pointer)
+                continue;
+
+            std::memcpy(&expected, trailer, sizeof(checksum_type));
+            trailer += sizeof(checksum_type);
+
+            if (util::crc32c(c.data_.cpos_, c.size_) !=
+                static_cast<std::uint32_t>(expected))
+            {
+                return -1;
+            }
+            bytes_verified += static_cast<std::int64_t>(c.size_);
+        }
+
+        buffer.data_.resize(size - trailer_size);
+        return bytes_verified;
+    }
+}}}
+
+#endif
+#endif
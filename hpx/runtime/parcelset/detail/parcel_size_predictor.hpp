@@ -0,0 +1,85 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_SIZE_PREDICTOR_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_SIZE_PREDICTOR_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/parcelset_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    // Keeps a rolling estimate of the encoded size of the parcels of each
+    // action, separated into the bytes stored in the parcel buffer itself
+    // and the bytes sent as zero-copy chunks. This is used to size the send
+    // buffers up front, the buffers grow as usual if the estimate was too
+    // small.
+    class HPX_EXPORT parcel_size_predictor
+    {
+    public:
+        struct estimate
+        {
+            std::size_t inline_bytes_;
+            std::size_t zero_copy_bytes_;
+            std::size_t num_chunks_;
+        };
+
+        parcel_size_predictor();
+
+        // predict the encoded size of the given parcel, the size of the
+        // parcel itself has to be known already (see parcel::size())
+        estimate predict(parcel const& p) const;
+
+        // predict the encoded size of a parcel for the given action, given
+        // its size (if known, otherwise 0) and its number of chunks
+        estimate predict(char const* action, std::size_t size,
+            std::size_t num_chunks) const;
+
+        // record the actual encoded size of a parcel for the given action
+        void update(char const* action, estimate const& actual);
+
+        // record that the send buffers had to grow beyond the prediction
+        void add_misprediction()
+        {
+            ++mispredictions_;
+        }
+
+        // number of encoded messages not fitting the predicted sizes
+        std::int64_t get_mispredictions(bool reset);
+
+    private:
+        // The estimates are kept in a fixed size open addressing table which
+        // is accessed using relaxed atomics only, as they are looked up for
+        // every parcel sent. Action names are static strings, they are
+        // identified by their address. Actions not fitting into the table
+        // are not predicted.
+        struct entry
+        {
+            std::atomic<char const*> action_;
+            std::atomic<std::size_t> inline_bytes_;
+            std::atomic<std::size_t> zero_copy_bytes_;
+            std::atomic<std::size_t> num_chunks_;
+        };
+
+        static constexpr std::size_t num_entries = 2048;
+
+        entry const* find(char const* action) const;
+        entry* find_or_insert(char const* action, bool& inserted);
+
+        std::unique_ptr<entry[]> entries_;
+        std::atomic<std::int64_t> mispredictions_;
+    };
+}}}
+
+#endif
+#endif
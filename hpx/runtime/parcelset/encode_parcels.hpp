@@ -19,6 +19,8 @@
 #include <hpx/logging.hpp>
 #include <hpx/runtime/actions/basic_action.hpp>
 #include <hpx/runtime/naming/split_gid.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_checksums.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_size_predictor.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -36,6 +38,7 @@
 #include <exception>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -81,6 +84,43 @@ namespace hpx
                 return result;
             }
 
+            // Send buffers which can't grow once they have been allocated
+            // (like the pinned memory used by the RDMA parcelports) are
+            // sized for the worst case.
+            template <typename BufferType>
+            struct is_growable_buffer : std::false_type
+            {
+            };
+
+            template <typename T, typename Allocator>
+            struct is_growable_buffer<std::vector<T, Allocator>>
+              : std::true_type
+            {
+            };
+
+            // record the encoded size of a parcel, the chunks starting at
+            // chunks_pos were created while encoding it
+            template <typename Chunks>
+            void update_size_prediction(parcel_size_predictor& predictor,
+                parcel const& p, Chunks const& chunks, std::size_t chunks_pos,
+                std::size_t inline_bytes)
+            {
+                actions::base_action* act = p.get_action();
+                if (act == nullptr)
+                    return;
+
+                parcel_size_predictor::estimate actual = {
+                    inline_bytes, 0, chunks.size() - chunks_pos};
+
+                for (std::size_t i = chunks_pos; i != chunks.size(); ++i)
+                {
+                    if (chunks[i].type_ == serialization::chunk_type_pointer)
+                        actual.zero_copy_bytes_ += chunks[i].size_;
+                }
+
+                predictor.update(act->get_action_name(), actual);
+            }
+
             template <typename Buffer>
             void encode_finalize(Buffer & buffer, std::size_t arg_size)
             {
@@ -141,35 +181,65 @@ namespace hpx
             // collect argument sizes from parcels
             std::size_t num_chunks = 0;
             std::size_t arg_size = 0;
+            std::size_t inline_size = 0;
             std::size_t parcels_sent = 0;
             std::size_t parcels_size = 1;
 
             if(num_parcels != std::size_t(-1))
             {
                 arg_size = sizeof(std::int64_t);
+                inline_size = sizeof(std::int64_t);
                 parcels_size = num_parcels;
             }
 
+            detail::parcel_size_predictor& predictor =
+                pp.get_size_predictor();
+
             // guard against serialization errors
             try {
                 try {
                     std::unique_ptr<serialization::binary_filter> filter(
                         ps[0].get_serialization_filter());
 
-                    int archive_flags = archive_flags_;
+                    // parcels are read by the localities of this application
+                    // only, which allows for identifying types by their ids
+                    // and for sending the receive tags of serialize_buffers
+                    int archive_flags = archive_flags_ |
+                        serialization::enable_type_ids |
+                        serialization::enable_receive_tags;
                     if (filter.get() != nullptr)
                         archive_flags |= serialization::enable_compression;
 
-                    // preallocate data
+                    // preallocate data, data sent as zero-copy chunks is not
+                    // stored in the buffer
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                     {
                         if (arg_size >= max_outbound_size)
                             break;
                         arg_size += ps[parcels_sent].size();
-                        num_chunks += ps[parcels_sent].num_chunks();
+
+                        detail::parcel_size_predictor::estimate e =
+                            predictor.predict(ps[parcels_sent]);
+                        inline_size += e.inline_bytes_;
+                        num_chunks += e.num_chunks_;
                     }
 
-                    buffer.data_.reserve(arg_size);
+                    // the filter is limited to the reserved size, buffers
+                    // which can't grow have to be sized for the worst case
+                    using data_type = decltype(buffer.data_);
+                    if (filter.get() != nullptr ||
+                        !detail::is_growable_buffer<data_type>::value)
+                    {
+                        inline_size = arg_size;
+                    }
+
+                    // the checksums are appended after serialization, the
+                    // zero-copy chunks leave enough room in buffers sized
+                    // for the worst case
+                    if (pp.checksums_enabled())
+                        inline_size += detail::checksum_trailer_size(0);
+
+                    buffer.data_.reserve(inline_size);
 
                     buffer.chunks_.reserve(num_chunks);
 
@@ -185,13 +255,17 @@ namespace hpx
                             buffer.data_, archive_flags, &buffer.chunks_,
                             filter.get());
 
+                        // the buffer was sized above, append to it directly
+                        archive.enable_direct_writes();
+
                         if (num_parcels != std::size_t(-1))
                             archive << parcels_sent; //-V128
 
                         for(std::size_t i = 0; i != parcels_sent; ++i)
                         {
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             std::size_t archive_pos = archive.current_pos();
+                            std::size_t chunks_pos = buffer.chunks_.size();
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             std::int64_t serialize_time =
                                 timer.elapsed_nanoseconds();
 #endif
@@ -209,6 +283,13 @@ namespace hpx
 
                             archive << ps[i];
 
+                            if (filter.get() == nullptr)
+                            {
+                                detail::update_size_prediction(predictor,
+                                    ps[i], buffer.chunks_, chunks_pos,
+                                    archive.current_pos() - archive_pos);
+                            }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             performance_counters::parcels::data_point action_data;
                             action_data.bytes_ = archive.current_pos() - archive_pos;
@@ -224,6 +305,16 @@ namespace hpx
                         arg_size = archive.bytes_written();
                     }
 
+                    // the buffers had to grow if the prediction was too small
+                    if (arg_size > inline_size ||
+                        buffer.chunks_.size() > num_chunks)
+                    {
+                        predictor.add_misprediction();
+                    }
+
+                    if (pp.checksums_enabled())
+                        detail::append_checksums(buffer);
+
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
@@ -97,6 +97,11 @@ namespace hpx { namespace parcelset
 
         std::shared_ptr<parcelport> get_bootstrap_parcelport() const;
 
+        /// Return the enabled parcelport with the highest priority, this is
+        /// the parcelport parcels are sent with if the destination supports
+        /// it.
+        std::shared_ptr<parcelport> get_default_parcelport() const;
+
         void initialize(naming::resolver_client &resolver, applier::applier *applier);
 
         void flush_parcels();
@@ -361,6 +366,24 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        std::int64_t get_queueing_time(std::string const& pp_type,
+            parcelport::parcel_lane lane, bool reset) const;
+
+        std::int64_t get_queueing_count(std::string const& pp_type,
+            parcelport::parcel_lane lane, bool reset) const;
+
+        std::int64_t get_size_mispredictions(
+            std::string const& pp_type, bool reset) const;
+
+        std::int64_t get_checksum_bytes_verified(
+            std::string const& pp_type, bool reset) const;
+
+        std::int64_t get_checksum_failures(
+            std::string const& pp_type, bool reset) const;
+
+        std::int64_t get_striped_message_count(
+            std::string const& pp_type, bool reset) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -398,6 +421,9 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        std::int64_t get_buffer_pool_statistics(std::string const& pp_type,
+            parcelport::buffer_pool_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
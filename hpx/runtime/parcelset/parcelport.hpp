@@ -20,9 +20,11 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/runtime/applier_fwd.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_size_predictor.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/util_fwd.hpp>
 
 #include <atomic>
@@ -182,6 +184,18 @@ namespace hpx { namespace parcelset
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given statistic of the pool of send buffers
+        using buffer_pool_statistics_type =
+            parcelset::buffer_pool_statistics_type;
+
+        // retrieve performance counter value for given statistics type,
+        // parcelports without a pool of send buffers always report zero
+        virtual std::int64_t get_buffer_pool_statistics(
+            buffer_pool_statistics_type, bool /* reset */)
+        {
+            return 0;
+        }
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -247,6 +261,66 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// Outgoing parcels are queued in separate lanes for each destination.
+        /// Parcels for actions with an elevated thread priority are queued in
+        /// the priority lane which is always drained first and which is
+        /// allowed to open an additional connection if all connections to
+        /// the destination are busy sending bulk data.
+        enum parcel_lane
+        {
+            parcel_lane_normal = 0,
+            parcel_lane_priority = 1,
+            num_parcel_lanes = 2
+        };
+
+        /// Return the lane the given parcel is queued in
+        static parcel_lane get_parcel_lane(parcel const& p);
+
+        /// the total time parcels were waiting in the given lane before
+        /// being picked up for sending (nanoseconds)
+        std::int64_t get_queueing_time(parcel_lane lane, bool reset);
+
+        /// the number of batches of parcels picked up from the given lane
+        std::int64_t get_queueing_count(parcel_lane lane, bool reset);
+
+        /// the number of messages which did not fit the predicted size of
+        /// their send buffers
+        std::int64_t get_size_mispredictions(bool reset);
+
+        /// Return the per-action estimates of the encoded parcel sizes used
+        /// to size the send buffers
+        detail::parcel_size_predictor& get_size_predictor()
+        {
+            return size_predictor_;
+        }
+
+        /// the number of bytes of received messages which were verified
+        /// against their checksums
+        std::int64_t get_checksum_bytes_verified(bool reset);
+
+        /// the number of received messages which failed the verification
+        /// of their checksums
+        std::int64_t get_checksum_failures(bool reset);
+
+        void add_checksum_verified(std::size_t bytes)
+        {
+            checksum_bytes_verified_ += static_cast<std::int64_t>(bytes);
+        }
+
+        void add_checksum_failure()
+        {
+            ++checksum_failures_;
+        }
+
+        /// the number of messages whose zero-copy data was striped over
+        /// several connections
+        std::int64_t get_striped_message_count(bool reset);
+
+        void add_striped_message()
+        {
+            ++striped_messages_;
+        }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -325,6 +399,12 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        /// Return whether messages carry a CRC-32C checksum
+        bool checksums_enabled() const
+        {
+            return enable_checksums_;
+        }
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(boost::system::error_code const& ec,
             parcel const & p);
@@ -335,13 +415,19 @@ namespace hpx { namespace parcelset
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
+        /// The cache for pending parcels, one for each lane. The last tuple
+        /// element holds the time the oldest pending parcel was enqueued.
         typedef util::tuple<
             std::vector<parcel>
           , std::vector<write_handler_type>
+          , std::int64_t
         > map_second_type;
         typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
+        pending_parcels_map pending_parcels_[num_parcel_lanes];
+
+        /// Per-lane queueing delay statistics
+        std::atomic<std::int64_t> queueing_time_[num_parcel_lanes];
+        std::atomic<std::int64_t> queueing_count_[num_parcel_lanes];
 
         typedef std::set<locality> pending_parcels_destinations;
         pending_parcels_destinations parcel_destinations_;
@@ -354,6 +440,16 @@ namespace hpx { namespace parcelset
         std::int64_t const max_inbound_message_size_;
         std::int64_t const max_outbound_message_size_;
 
+        /// Per-action estimates of the encoded parcel sizes
+        detail::parcel_size_predictor size_predictor_;
+
+        /// Checksum verification statistics
+        std::atomic<std::int64_t> checksum_bytes_verified_;
+        std::atomic<std::int64_t> checksum_failures_;
+
+        /// Number of messages sent striped over several connections
+        std::atomic<std::int64_t> striped_messages_;
+
         /// Overall parcel statistics
         performance_counters::parcels::gatherer parcels_sent_;
         performance_counters::parcels::gatherer parcels_received_;
@@ -371,6 +467,9 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// messages carry a CRC-32C checksum
+        bool enable_checksums_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
@@ -98,6 +98,10 @@ namespace hpx { namespace parcelset {
 
         virtual ~parcelport_connection() {}
 
+        /// Called before the next message is encoded into \a buffer_,
+        /// connections which recycle their buffers acquire one here.
+        void acquire_buffer() {}
+
         /// buffer for data
         parcel_buffer_type buffer_;
     };
@@ -25,6 +25,7 @@
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/threads/thread.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/util/connection_cache.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/util/get_entry_as.hpp>
@@ -39,6 +40,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -147,6 +149,7 @@ namespace hpx { namespace parcelset
 
         ~parcelport_impl() override
         {
+            clear_priority_connections();
             connection_cache_.clear();
         }
 
@@ -196,6 +199,7 @@ namespace hpx { namespace parcelset
                 io_service_pool_.wait();
                 io_service_pool_.stop();
                 io_service_pool_.join();
+                clear_priority_connections();
                 connection_cache_.clear();
                 io_service_pool_.clear();
             }
@@ -332,6 +336,7 @@ namespace hpx { namespace parcelset
                 if (!ec) return;
             }
 
+            clear_priority_connections(loc);
             connection_cache_.clear(loc);
         }
 
@@ -579,7 +584,7 @@ namespace hpx { namespace parcelset
     private:
         ///////////////////////////////////////////////////////////////////////
         std::shared_ptr<connection> get_connection(
-            locality const& l, bool force, error_code& ec)
+            locality const& l, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
@@ -612,12 +617,139 @@ namespace hpx { namespace parcelset
             return sender_connection;
         }
 
+        // Every destination has one connection reserved for the priority
+        // lane. It is kept outside of the connection cache, so it is neither
+        // evicted when the cache runs full nor handed out to bulk traffic.
+        // Returns an empty pointer if the connection is currently busy.
+        std::shared_ptr<connection> get_priority_connection(
+            locality const& l, error_code& ec)
+        {
+            {
+                std::lock_guard<mutex_type> lk(priority_connections_mtx_);
+
+                auto it = priority_connections_.find(l);
+                if (it != priority_connections_.end())
+                {
+                    if (it->second.in_use_)
+                    {
+                        if (&ec != &throws)
+                            ec = make_success_code();
+                        return std::shared_ptr<connection>();
+                    }
+
+                    it->second.in_use_ = true;
+                    HPX_ASSERT(it->second.connection_);
+
+                    if (&ec != &throws)
+                        ec = make_success_code();
+                    return it->second.connection_;
+                }
+
+                // reserve the slot while the connection is being created
+                priority_connections_.emplace(l, priority_connection());
+            }
+
+            std::shared_ptr<connection> sender_connection =
+                connection_handler().create_connection(l, ec);
+
+            std::lock_guard<mutex_type> lk(priority_connections_mtx_);
+
+            auto it = priority_connections_.find(l);
+            HPX_ASSERT(it != priority_connections_.end());
+
+            // a discarded connection is dropped once it is released
+            if (!sender_connection)
+                priority_connections_.erase(it);
+            else
+                it->second.connection_ = sender_connection;
+
+            return sender_connection;
+        }
+
+        // Hand a connection back after it was used for sending parcels,
+        // connections which have failed are dropped.
+        void release_connection(locality const& l,
+            std::shared_ptr<connection> const& sender_connection,
+            bool failed = false)
+        {
+            {
+                std::lock_guard<mutex_type> lk(priority_connections_mtx_);
+
+                auto it = priority_connections_.find(l);
+                if (it != priority_connections_.end() &&
+                    it->second.connection_ == sender_connection)
+                {
+                    HPX_ASSERT(it->second.in_use_);
+                    if (failed || it->second.discard_)
+                        priority_connections_.erase(it);
+                    else
+                        it->second.in_use_ = false;
+                    return;
+                }
+            }
+
+            if (!failed)
+                connection_cache_.reclaim(l, sender_connection);
+            else
+                connection_cache_.clear(l, sender_connection);
+        }
+
+        // Drop the idle priority connections, the ones currently in use are
+        // dropped as soon as they are released.
+        void clear_priority_connections()
+        {
+            std::lock_guard<mutex_type> lk(priority_connections_mtx_);
+
+            for (auto it = priority_connections_.begin();
+                 it != priority_connections_.end(); /**/)
+            {
+                if (it->second.in_use_)
+                {
+                    it->second.discard_ = true;
+                    ++it;
+                }
+                else
+                {
+                    it = priority_connections_.erase(it);
+                }
+            }
+        }
+
+        void clear_priority_connections(locality const& l)
+        {
+            std::lock_guard<mutex_type> lk(priority_connections_mtx_);
+
+            auto it = priority_connections_.find(l);
+            if (it == priority_connections_.end())
+                return;
+
+            if (it->second.in_use_)
+                it->second.discard_ = true;
+            else
+                priority_connections_.erase(it);
+        }
+
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(locality const& locality_id,
+        // Append the given parcel to the pending parcels of the lane it
+        // belongs to. The caller is expected to hold mtx_.
+        void enqueue_parcel_locked(locality const& locality_id,
             parcel&& p, write_handler_type&& f)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
+            mapped_type& e = pending_parcels_[get_parcel_lane(p)][locality_id];
+            if (util::get<0>(e).empty())
+            {
+                util::get<2>(e) = static_cast<std::int64_t>(
+                    util::high_resolution_clock::now());
+            }
+            util::get<0>(e).push_back(std::move(p));
+            util::get<1>(e).push_back(std::move(f));
+        }
+
+        void enqueue_parcel(locality const& locality_id,
+            parcel&& p, write_handler_type&& f)
+        {
             std::unique_lock<lcos::local::spinlock> l(mtx_);
             // We ignore the lock here. It might happen that while enqueuing,
             // we need to acquire a lock. This should not cause any problems
@@ -626,9 +758,7 @@ namespace hpx { namespace parcelset
                 std::unique_lock<lcos::local::spinlock>
             > il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
-            util::get<0>(e).push_back(std::move(p));
-            util::get<1>(e).push_back(std::move(f));
+            enqueue_parcel_locked(locality_id, std::move(p), std::move(f));
 
             parcel_destinations_.insert(locality_id);
             ++num_parcel_destinations_;
@@ -649,13 +779,36 @@ namespace hpx { namespace parcelset
             > il(&l);
 
             HPX_ASSERT(parcels.size() == handlers.size());
+            if (parcels.empty())
+                return;
+
+            // parcels of mixed priority are distributed to their lanes one
+            // by one
+            parcel_lane lane = get_parcel_lane(parcels[0]);
+            for (std::size_t i = 1; i != parcels.size(); ++i)
+            {
+                if (get_parcel_lane(parcels[i]) != lane)
+                {
+                    for (std::size_t j = 0; j != parcels.size(); ++j)
+                    {
+                        enqueue_parcel_locked(locality_id,
+                            std::move(parcels[j]), std::move(handlers[j]));
+                    }
+
+                    parcel_destinations_.insert(locality_id);
+                    ++num_parcel_destinations_;
+                    return;
+                }
+            }
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels_[lane][locality_id];
             if (util::get<0>(e).empty())
             {
                 HPX_ASSERT(util::get<1>(e).empty());
                 std::swap(util::get<0>(e), parcels);
                 std::swap(util::get<1>(e), handlers);
+                util::get<2>(e) = static_cast<std::int64_t>(
+                    util::high_resolution_clock::now());
             }
             else
             {
@@ -674,9 +827,39 @@ namespace hpx { namespace parcelset
             ++num_parcel_destinations_;
         }
 
+        // Return whether parcels are pending for the given destination in the
+        // given lane. The caller is expected to hold mtx_.
+        bool has_pending_parcels_locked(
+            locality const& locality_id, parcel_lane lane) const
+        {
+            auto it = pending_parcels_[lane].find(locality_id);
+            return it != pending_parcels_[lane].end() &&
+                !util::get<0>(it->second).empty();
+        }
+
+        bool has_pending_parcels(locality const& locality_id, parcel_lane lane)
+        {
+            std::lock_guard<lcos::local::spinlock> l(mtx_);
+            return has_pending_parcels_locked(locality_id, lane);
+        }
+
+        // Record the time the oldest of the parcels taken from the given lane
+        // spent waiting in the queue
+        void record_queueing_time(parcel_lane lane, std::int64_t enqueued)
+        {
+            std::int64_t now =
+                static_cast<std::int64_t>(util::high_resolution_clock::now());
+            queueing_time_[lane] += now - enqueued;
+            ++queueing_count_[lane];
+        }
+
+        // Take all parcels pending for the given destination in the given
+        // lane. If any_lane is true the parcels of the other lane are taken
+        // if the given lane has no parcels pending.
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
-            std::vector<write_handler_type>& handlers)
+            std::vector<write_handler_type>& handlers,
+            parcel_lane lane = parcel_lane_priority, bool any_lane = true)
         {
             using iterator = pending_parcels_map::iterator;
 
@@ -685,30 +868,48 @@ namespace hpx { namespace parcelset
 
                 if (!l) return false;
 
-                iterator it = pending_parcels_.find(locality_id);
+                iterator it = pending_parcels_[lane].find(locality_id);
 
                 // do nothing if parcels have already been picked up by
                 // another thread
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
+                if (it == pending_parcels_[lane].end() ||
+                    util::get<0>(it->second).empty())
                 {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, util::get<0>(it->second));
-                    HPX_ASSERT(util::get<0>(it->second).size() == 0);
-                    std::swap(handlers, util::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
+                    if (!any_lane)
+                        return false;
+
+                    lane = lane == parcel_lane_priority ? parcel_lane_normal :
+                        parcel_lane_priority;
+                    it = pending_parcels_[lane].find(locality_id);
+
+                    if (it == pending_parcels_[lane].end() ||
+                        util::get<0>(it->second).empty())
+                    {
+                        return false;
+                    }
                 }
-                else
+
+                HPX_ASSERT(it->first == locality_id);
+                HPX_ASSERT(handlers.size() == 0);
+                HPX_ASSERT(handlers.size() == parcels.size());
+                std::swap(parcels, util::get<0>(it->second));
+                HPX_ASSERT(util::get<0>(it->second).size() == 0);
+                std::swap(handlers, util::get<1>(it->second));
+                HPX_ASSERT(handlers.size() == parcels.size());
+
+                HPX_ASSERT(!handlers.empty());
+
+                record_queueing_time(lane, util::get<2>(it->second));
+
+                // the destination stays active as long as the other lane has
+                // parcels pending
+                if (!has_pending_parcels_locked(locality_id,
+                        lane == parcel_lane_priority ? parcel_lane_normal :
+                            parcel_lane_priority))
                 {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
-                    return false;
+                    parcel_destinations_.erase(locality_id);
                 }
 
-                parcel_destinations_.erase(locality_id);
-
                 HPX_ASSERT(0 != num_parcel_destinations_.load());
                 --num_parcel_destinations_;
 
@@ -724,23 +925,28 @@ namespace hpx { namespace parcelset
 
                 if (!l) return false;
 
-                for (auto &pending: pending_parcels_)
+                for (std::size_t lane = parcel_lane_priority + 1; lane-- != 0;)
                 {
-                    auto &parcels = util::get<0>(pending.second);
-                    if (!parcels.empty())
+                    for (auto &pending: pending_parcels_[lane])
                     {
-                        auto& handlers = util::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
+                        auto &parcels = util::get<0>(pending.second);
+                        if (!parcels.empty())
                         {
-                            pending_parcels_.erase(dest);
+                            auto& handlers = util::get<1>(pending.second);
+                            dest = pending.first;
+                            p = std::move(parcels.back());
+                            parcels.pop_back();
+                            handler = std::move(handlers.back());
+                            handlers.pop_back();
+
+                            if (parcels.empty())
+                            {
+                                record_queueing_time(parcel_lane(lane),
+                                    util::get<2>(pending.second));
+                                pending_parcels_[lane].erase(dest);
+                            }
+                            return true;
                         }
-                        return true;
                     }
                 }
             }
@@ -793,13 +999,35 @@ namespace hpx { namespace parcelset
                 return;
             }
 
-            // If one of the sending threads are in suspended state, we
-            // need to force a new connection to avoid deadlocks.
-            bool force_connection = true;
-
+            // Parcels in the priority lane must not wait for a connection
+            // which is busy sending bulk data, they use the connection
+            // reserved for them if it is available. A connection is used for
+            // the parcels of its own lane only, unless the priority
+            // connection could not be created.
             error_code ec;
-            std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
+            std::shared_ptr<connection> sender_connection;
+            parcel_lane lane = parcel_lane_priority;
+            bool any_lane = true;
+            if (has_pending_parcels(locality_id, parcel_lane_priority))
+            {
+                sender_connection = get_priority_connection(locality_id, ec);
+                if (sender_connection)
+                {
+                    any_lane = false;
+                }
+                else if (!ec)
+                {
+                    // the priority connection is busy, it picks up the
+                    // priority parcels as soon as it is released
+                    lane = parcel_lane_normal;
+                    any_lane = false;
+                }
+            }
+
+            if (!sender_connection)
+            {
+                sender_connection = get_connection(locality_id, ec);
+            }
 
             if (!sender_connection)
             {
@@ -814,11 +1042,10 @@ namespace hpx { namespace parcelset
             std::vector<parcel> parcels;
             std::vector<write_handler_type> handlers;
 
-            if(!dequeue_parcels(locality_id, parcels, handlers))
+            if(!dequeue_parcels(locality_id, parcels, handlers, lane, any_lane))
             {
-                // Give this connection back to the cache as we couldn't dequeue
-                // parcels.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                // Give this connection back as we couldn't dequeue parcels.
+                release_connection(locality_id, sender_connection);
 
                 return;
             }
@@ -847,24 +1074,18 @@ namespace hpx { namespace parcelset
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             sender_connection->set_state(connection::state_scheduled_thread);
 #endif
-            if (!ec)
-            {
-                // Give this connection back to the cache as it's not
-                // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
-            }
-            else
-            {
-                // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
-            }
+            // Give this connection back as it's not needed anymore, failed
+            // connections are removed.
+            release_connection(locality_id, sender_connection, !!ec);
             {
                 std::lock_guard<lcos::local::spinlock> l(mtx_);
 
 //                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
+                if (!has_pending_parcels_locked(locality_id, parcel_lane_priority) &&
+                    !has_pending_parcels_locked(locality_id, parcel_lane_normal))
+                {
                     return;
+                }
             }
 
             // Create a new HPX thread which sends parcels that are still
@@ -888,6 +1109,7 @@ namespace hpx { namespace parcelset
             sender_connection->verify_(parcel_locality_id);
 #endif
             // encode the parcels
+            sender_connection->acquire_buffer();
             std::size_t num_parcels = encode_parcels(*this, &parcels[0],
                     parcels.size(), sender_connection->buffer_,
                     archive_flags_,
@@ -954,6 +1176,24 @@ namespace hpx { namespace parcelset
 
         using mutex_type = hpx::lcos::local::spinlock;
 
+        /// The connections reserved for the priority lane, one per
+        /// destination
+        struct priority_connection
+        {
+            priority_connection()
+              : in_use_(true)
+              , discard_(false)
+            {
+            }
+
+            std::shared_ptr<connection> connection_;
+            bool in_use_;
+            bool discard_;
+        };
+
+        mutex_type priority_connections_mtx_;
+        std::map<locality, priority_connection> priority_connections_;
+
         int archive_flags_;
         hpx::util::atomic_count operations_in_flight_;
 
@@ -85,6 +85,13 @@ namespace hpx {
             parcelport_background_mode_all = 0x07
         };
 
+        /// Statistics of the pool of send buffers of a parcelport
+        enum buffer_pool_statistics_type
+        {
+            buffer_pool_hits = 0,
+            buffer_pool_misses = 1
+        };
+
         HPX_API_EXPORT bool do_background_work(std::size_t num_thread = 0,
             parcelport_background_mode mode = parcelport_background_mode_all);
 
@@ -18,6 +18,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -103,6 +104,10 @@ namespace hpx { namespace util
 
         void free(void* p, std::size_t count = 1);
 
+        // release a number of objects at once, consecutive objects allocated
+        // from the same heap are given back by a single call to that heap
+        void free_bulk(std::vector<void*> ptrs);
+
         bool did_alloc(void* p) const;
 
         std::string name() const;
@@ -0,0 +1,474 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_2020)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_2020
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/type_support/always_void.hpp>
+
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map an arithmetic value onto an unsigned integer preserving the order
+    // of the values as defined by operator<().
+    template <typename T, typename Enable = void>
+    struct radix_sort_key;
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type call(T value)
+        {
+            // flip the sign bit of signed values
+            return std::is_signed<T>::value ?
+                type(type(value) ^ (type(1) << (8 * sizeof(T) - 1))) :
+                type(value);
+        }
+    };
+
+    template <typename T, typename Bits>
+    struct radix_sort_floating_point_key
+    {
+        static_assert(std::numeric_limits<T>::is_iec559 &&
+                sizeof(T) == sizeof(Bits),
+            "radix sort requires IEEE 754 floating point values");
+
+        typedef Bits type;
+
+        static type call(T value)
+        {
+            type bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            // negative values: flip all bits, positive values: flip the
+            // sign bit
+            type const sign = type(1) << (8 * sizeof(type) - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    template <>
+    struct radix_sort_key<float>
+      : radix_sort_floating_point_key<float, std::uint32_t>
+    {
+    };
+
+    template <>
+    struct radix_sort_key<double>
+      : radix_sort_floating_point_key<double, std::uint64_t>
+    {
+    };
+
+    template <typename T, typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sortable<T,
+        typename hpx::util::always_void<
+            typename radix_sort_key<T>::type>::type> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the keys are sorted digit by digit, using 8 bits per digit
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_bits;
+
+    // the minimal number of elements sorted by one task
+    static const std::size_t radix_sort_min_chunk_size = 16384ul;
+
+    // used instead of the value iterators if only keys are sorted
+    struct radix_sort_no_values
+    {
+    };
+
+    template <typename Src, typename Dst>
+    void radix_sort_move_value(
+        Src src, std::size_t from, Dst dest, std::size_t to)
+    {
+        dest[to] = std::move(src[from]);
+    }
+
+    inline void radix_sort_move_value(
+        radix_sort_no_values, std::size_t, radix_sort_no_values, std::size_t)
+    {
+    }
+
+    template <typename ValueIter>
+    struct radix_sort_value_buffer
+    {
+        typedef typename std::iterator_traits<ValueIter>::value_type
+            value_type;
+        typedef value_type* iterator;
+
+        explicit radix_sort_value_buffer(std::size_t count)
+          : data_(count)
+        {
+        }
+
+        iterator begin()
+        {
+            return data_.data();
+        }
+
+        std::vector<value_type> data_;
+    };
+
+    template <>
+    struct radix_sort_value_buffer<radix_sort_no_values>
+    {
+        typedef radix_sort_no_values iterator;
+
+        explicit radix_sort_value_buffer(std::size_t) {}
+
+        iterator begin()
+        {
+            return iterator();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // invoke f(chunk) for all chunks, concurrently if allowed by the policy
+    template <typename ExPolicy, typename F>
+    void radix_sort_for_each_chunk(
+        ExPolicy const& policy, std::size_t num_chunks, F const& f)
+    {
+        if (execution::is_sequenced_execution_policy<ExPolicy>::value ||
+            num_chunks == 1)
+        {
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                f(chunk);
+            return;
+        }
+
+        std::vector<hpx::future<void>> chunks;
+        chunks.reserve(num_chunks);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            chunks.push_back(execution::async_execute(
+                policy.executor(), [&f, chunk]() -> void { f(chunk); }));
+        }
+
+        hpx::wait_all(chunks);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(chunks, errors);
+    }
+
+    // count the digits of the given pass for the keys in [first, last)
+    template <typename KeyIter>
+    void radix_sort_histogram(KeyIter first, KeyIter last, std::size_t shift,
+        std::size_t* histogram)
+    {
+        typedef radix_sort_key<
+            typename std::iterator_traits<KeyIter>::value_type>
+            radix_key;
+
+        std::fill(histogram, histogram + radix_sort_buckets, std::size_t(0));
+        for (/**/; first != last; ++first)
+        {
+            ++histogram[(radix_key::call(*first) >> shift) &
+                (radix_sort_buckets - 1)];
+        }
+    }
+
+    // Move the elements [first, last) to their positions for the given
+    // pass, offsets holds the next position for each of the digits.
+    template <typename KeySrc, typename ValueSrc, typename KeyDst,
+        typename ValueDst>
+    void radix_sort_scatter(KeySrc keys, ValueSrc values, std::size_t first,
+        std::size_t last, KeyDst key_dest, ValueDst value_dest,
+        std::size_t shift, std::size_t* offsets)
+    {
+        typedef radix_sort_key<typename std::iterator_traits<KeySrc>::value_type>
+            radix_key;
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            std::size_t const pos = offsets[(radix_key::call(keys[i]) >> shift) &
+                (radix_sort_buckets - 1)]++;
+
+            key_dest[pos] = keys[i];
+            radix_sort_move_value(values, i, value_dest, pos);
+        }
+    }
+
+    // If only keys are sorted, the keys are collected in a small buffer for
+    // each of the digits (one cache line each) and are written to their
+    // destination once a buffer is full. This avoids touching a different
+    // cache line of the destination for each of the keys.
+    template <typename KeySrc, typename KeyDst>
+    void radix_sort_scatter(KeySrc keys, radix_sort_no_values,
+        std::size_t first, std::size_t last, KeyDst key_dest,
+        radix_sort_no_values, std::size_t shift, std::size_t* offsets)
+    {
+        typedef typename std::iterator_traits<KeySrc>::value_type key_type;
+        typedef radix_sort_key<key_type> radix_key;
+
+        static constexpr std::size_t buffer_size =
+            threads::get_cache_line_size() / sizeof(key_type) != 0 ?
+            threads::get_cache_line_size() / sizeof(key_type) :
+            1;
+
+        std::vector<key_type> buffers(radix_sort_buckets * buffer_size);
+        std::vector<std::size_t> fill(radix_sort_buckets, 0);
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            key_type const key = keys[i];
+            std::size_t const digit =
+                (radix_key::call(key) >> shift) & (radix_sort_buckets - 1);
+
+            key_type* buffer = &buffers[digit * buffer_size];
+            buffer[fill[digit]] = key;
+            if (++fill[digit] == buffer_size)
+            {
+                std::copy(buffer, buffer + buffer_size,
+                    key_dest + offsets[digit]);
+                offsets[digit] += buffer_size;
+                fill[digit] = 0;
+            }
+        }
+
+        for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+        {
+            key_type* buffer = &buffers[digit * buffer_size];
+            std::copy(buffer, buffer + fill[digit], key_dest + offsets[digit]);
+            offsets[digit] += fill[digit];
+        }
+    }
+
+    // the number of chunks to split the keys into
+    template <typename ExPolicy>
+    std::size_t radix_sort_num_chunks(ExPolicy const& policy, std::size_t count)
+    {
+        if (execution::is_sequenced_execution_policy<ExPolicy>::value)
+            return 1;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(policy.parameters(),
+            policy.executor(), [] { return 0; }, cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        chunk_size = (std::max)(chunk_size, radix_sort_min_chunk_size);
+        return (std::max)(
+            std::size_t(1), (count + chunk_size - 1) / chunk_size);
+    }
+
+    //-------------------------------------------------------------------------
+    //  function : radix_sort
+    //-------------------------------------------------------------------------
+    /// @param [in] keys : iterator to the first key to sort
+    /// @param [in] values : iterator to the values associated with the keys
+    ///                      (or radix_sort_no_values)
+    /// @param [in] count : number of elements to sort
+    /// @remarks Least significant digit radix sort, each pass is stable. The
+    ///          keys are split into chunks, all of the passes process the
+    ///          same chunks of the source sequence in the same task: each
+    ///          task counts the digits of its chunk, the positions of the
+    ///          digits of all chunks are computed and each task moves the
+    ///          elements of its chunk to the destination. The elements are
+    ///          moved alternately to a buffer and back. Passes for which all
+    ///          keys have the same digit are skipped.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    void radix_sort(ExPolicy const& policy, KeyIter keys, ValueIter values,
+        std::size_t count)
+    {
+        typedef typename std::iterator_traits<KeyIter>::value_type key_type;
+        typedef radix_sort_key<key_type> radix_key;
+        typedef radix_sort_value_buffer<ValueIter> value_buffer_type;
+
+        if (count < 2)
+            return;
+
+        std::size_t const num_passes =
+            sizeof(typename radix_key::type) * 8 / radix_sort_bits;
+        std::size_t const num_chunks = radix_sort_num_chunks(policy, count);
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+        auto chunk_first = [=](std::size_t chunk) {
+            return (std::min)(chunk * chunk_size, count);
+        };
+
+        // count the digits of all passes for each of the chunks
+        std::size_t const histogram_size = num_passes * radix_sort_buckets;
+        std::vector<std::size_t> histograms(num_chunks * histogram_size);
+
+        radix_sort_for_each_chunk(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* histogram = &histograms[chunk * histogram_size];
+            for (std::size_t i = chunk_first(chunk),
+                             end = chunk_first(chunk + 1);
+                 i != end; ++i)
+            {
+                typename radix_key::type const key = radix_key::call(keys[i]);
+                for (std::size_t pass = 0; pass != num_passes; ++pass)
+                {
+                    ++histogram[pass * radix_sort_buckets +
+                        ((key >> (pass * radix_sort_bits)) &
+                            (radix_sort_buckets - 1))];
+                }
+            }
+        });
+
+        // skip the passes for which all keys have the same digit
+        std::vector<std::size_t> passes;
+        for (std::size_t pass = 0; pass != num_passes; ++pass)
+        {
+            bool same_digit = false;
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                std::size_t total = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    total += histograms[chunk * histogram_size +
+                        pass * radix_sort_buckets + digit];
+                }
+                if (total != 0)
+                {
+                    same_digit = (total == count);
+                    break;
+                }
+            }
+            if (!same_digit)
+                passes.push_back(pass);
+        }
+
+        if (passes.empty())
+            return;
+
+        std::vector<key_type> key_buffer(count);
+        value_buffer_type value_buffer(count);
+
+        std::vector<std::size_t> offsets(num_chunks * radix_sort_buckets);
+        bool in_buffer = false;
+
+        for (std::size_t pass : passes)
+        {
+            std::size_t const shift = pass * radix_sort_bits;
+
+            // the counts of all but the first pass depend on the order
+            // established by the previous passes
+            if (pass != passes.front())
+            {
+                radix_sort_for_each_chunk(
+                    policy, num_chunks, [&](std::size_t chunk) {
+                        std::size_t* histogram =
+                            &histograms[chunk * histogram_size +
+                                pass * radix_sort_buckets];
+                        if (in_buffer)
+                        {
+                            radix_sort_histogram(
+                                key_buffer.begin() + chunk_first(chunk),
+                                key_buffer.begin() + chunk_first(chunk + 1),
+                                shift, histogram);
+                        }
+                        else
+                        {
+                            radix_sort_histogram(keys + chunk_first(chunk),
+                                keys + chunk_first(chunk + 1), shift,
+                                histogram);
+                        }
+                    });
+            }
+
+            // the elements with the same digit are placed in the order of
+            // the chunks they belong to
+            std::size_t pos = 0;
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    offsets[chunk * radix_sort_buckets + digit] = pos;
+                    pos += histograms[chunk * histogram_size +
+                        pass * radix_sort_buckets + digit];
+                }
+            }
+            HPX_ASSERT(pos == count);
+
+            radix_sort_for_each_chunk(
+                policy, num_chunks, [&](std::size_t chunk) {
+                    std::size_t* chunk_offsets =
+                        &offsets[chunk * radix_sort_buckets];
+                    if (in_buffer)
+                    {
+                        radix_sort_scatter(key_buffer.data(),
+                            value_buffer.begin(), chunk_first(chunk),
+                            chunk_first(chunk + 1), keys, values, shift,
+                            chunk_offsets);
+                    }
+                    else
+                    {
+                        radix_sort_scatter(keys, values, chunk_first(chunk),
+                            chunk_first(chunk + 1), key_buffer.data(),
+                            value_buffer.begin(), shift, chunk_offsets);
+                    }
+                });
+
+            in_buffer = !in_buffer;
+        }
+
+        // move the elements back if the last pass has left them in the
+        // buffer
+        if (in_buffer)
+        {
+            radix_sort_for_each_chunk(
+                policy, num_chunks, [&](std::size_t chunk) {
+                    std::size_t const first = chunk_first(chunk);
+                    std::size_t const last = chunk_first(chunk + 1);
+
+                    std::copy(key_buffer.begin() + first,
+                        key_buffer.begin() + last, keys + first);
+                    for (std::size_t i = first; i != last; ++i)
+                    {
+                        radix_sort_move_value(
+                            value_buffer.begin(), i, values, i);
+                    }
+                });
+        }
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
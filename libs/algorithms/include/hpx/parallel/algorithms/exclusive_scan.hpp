@@ -20,6 +20,7 @@
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
@@ -116,6 +117,74 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
+                typedef util::is_lookback_scan_supported<T, zip_iterator>
+                    use_lookback_scan;
+
+                return parallel_scan(std::forward<ExPolicy>(policy), first,
+                    last, count, dest, final_dest, init, std::forward<Op>(op),
+                    std::forward<Conv>(conv), use_lookback_scan());
+            }
+
+        private:
+            // single pass scan, each tile is reduced and then scanned while
+            // it is still cached
+            template <typename ExPolicy, typename FwdIter1, typename T,
+                typename Op, typename Conv>
+            static typename util::detail::algorithm_result<ExPolicy,
+                FwdIter2>::type
+            parallel_scan(ExPolicy&& policy, FwdIter1 first, FwdIter1,
+                std::size_t count, FwdIter2 dest, FwdIter2 final_dest,
+                T const& init, Op&& op, Conv&& conv, std::true_type)
+            {
+                typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
+                    zip_iterator;
+
+                using hpx::util::get;
+                using hpx::util::make_zip_iterator;
+
+                return util::lookback_scan_partitioner<ExPolicy, FwdIter2, T>::
+                    call(std::forward<ExPolicy>(policy),
+                        make_zip_iterator(first, dest), count, init,
+                        // step 1 reduces a tile
+                        [op, conv](zip_iterator part_begin,
+                            std::size_t part_size) -> T {
+                            FwdIter1 it =
+                                get<0>(part_begin.get_iterator_tuple());
+                            T val = hpx::util::invoke(conv, *it);
+                            while (--part_size != 0)
+                            {
+                                val = hpx::util::invoke(
+                                    op, val, hpx::util::invoke(conv, *++it));
+                            }
+                            return val;
+                        },
+                        // step 2 scans a tile, starting with the result of
+                        // all elements before it
+                        [op, conv](zip_iterator part_begin,
+                            std::size_t part_size, T const& prefix) {
+                            auto iters = part_begin.get_iterator_tuple();
+                            sequential_exclusive_scan_n(get<0>(iters),
+                                part_size, get<1>(iters), prefix, op, conv);
+                        },
+                        // combines the results of two tiles
+                        op,
+                        // use this return value
+                        [final_dest]() { return final_dest; });
+            }
+
+            // two pass scan, the partial results of each partition are
+            // corrected once the results of all preceding partitions are known
+            template <typename ExPolicy, typename FwdIter1, typename T,
+                typename Op, typename Conv>
+            static typename util::detail::algorithm_result<ExPolicy,
+                FwdIter2>::type
+            parallel_scan(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+                std::size_t count, FwdIter2 dest, FwdIter2 final_dest,
+                T const& init, Op&& op, Conv&& conv, std::false_type)
+            {
+                typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
+                    zip_iterator;
+
                 // The overall scan algorithm is performed by executing 3
                 // steps. The first calculates the scan results for each
                 // partition. The second accumulates the result from left to
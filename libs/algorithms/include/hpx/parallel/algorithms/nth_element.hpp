@@ -0,0 +1,301 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_2020)
+#define HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_2020
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Compares the elements to the pivot, selecting the elements less
+        // than the pivot or the elements not greater than the pivot.
+        template <typename RandomIt, typename Compare>
+        struct nth_element_pivot_predicate
+        {
+            template <typename T>
+            bool operator()(T const& value) const
+            {
+                if (less_)
+                    return hpx::util::invoke(comp_, value, *pivot_);
+                return !hpx::util::invoke(comp_, *pivot_, value);
+            }
+
+            RandomIt pivot_;
+            Compare comp_;
+            bool less_;
+        };
+
+        template <typename RandomIt, typename Compare>
+        RandomIt nth_element_median_of_three(
+            RandomIt a, RandomIt b, RandomIt c, Compare const& comp)
+        {
+            if (comp(*a, *b))
+            {
+                if (comp(*b, *c))
+                    return b;
+                return comp(*a, *c) ? c : a;
+            }
+            if (comp(*a, *c))
+                return a;
+            return comp(*b, *c) ? c : b;
+        }
+
+        //---------------------------------------------------------------------
+        //  function : parallel_nth_element
+        //---------------------------------------------------------------------
+        /// @param [in] first : iterator to the first element of the range
+        /// @param [in] nth : iterator to the element to put in place
+        /// @param [in] last : iterator to the next element after the last
+        /// @param [in] comp : object for to compare the elements
+        /// @remarks Partitions the range around a pivot in parallel, the
+        ///          partition containing nth is selected until it is small
+        ///          enough to be handled sequentially. The number of
+        ///          partitioning steps is limited to guard against bad pivots.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void parallel_nth_element(ExPolicy const& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare const& comp)
+        {
+            if (nth == last)
+                return;
+
+            std::size_t depth_limit = 0;
+            for (std::size_t n = last - first; n > 1; n >>= 1)
+                depth_limit += 2;
+
+            while (std::size_t(last - first) > sort_limit_per_task &&
+                depth_limit-- != 0)
+            {
+                // move the pivot to the front of the range
+                std::iter_swap(first,
+                    nth_element_median_of_three(
+                        first, first + (last - first) / 2, last - 1, comp));
+
+                nth_element_pivot_predicate<RandomIt, Compare> less{
+                    first, comp, true};
+                RandomIt bound = partition_helper::call(policy, first + 1,
+                    last, less, util::projection_identity());
+
+                // put the pivot in between the two partitions
+                --bound;
+                std::iter_swap(first, bound);
+
+                if (nth == bound)
+                    return;
+
+                if (nth < bound)
+                {
+                    last = bound;
+                    continue;
+                }
+
+                if (bound == first)
+                {
+                    // the pivot is the smallest element, skip all elements
+                    // equal to the pivot to avoid stalling on many
+                    // equivalent elements
+                    nth_element_pivot_predicate<RandomIt, Compare> not_greater{
+                        bound, comp, false};
+                    RandomIt equal_end = partition_helper::call(policy,
+                        bound + 1, last, not_greater,
+                        util::projection_identity());
+
+                    if (nth < equal_end)
+                        return;
+
+                    first = equal_end;
+                    continue;
+                }
+
+                first = bound + 1;
+            }
+
+            std::nth_element(first, nth, last, comp);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // nth_element
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+                typedef typename std::decay<ExPolicy>::type policy_type;
+
+                util::compare_projected<Compare, Proj> comp_projected(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                try
+                {
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [first, nth, last, comp_projected](
+                            policy_type const& policy) -> RandomIt {
+                            try
+                            {
+                                parallel_nth_element(
+                                    policy, first, nth, last, comp_projected);
+                            }
+                            catch (...)
+                            {
+                                util::detail::handle_local_exceptions<
+                                    policy_type>::call(
+                                    std::current_exception());
+                            }
+                            return last;
+                        },
+                        std::forward<ExPolicy>(policy)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would
+    /// occur in that position if [first, last) were sorted. All of the
+    /// elements before this new \a nth element are less than or equal to the
+    /// elements after the new \a nth element. The function uses the given
+    /// comparison function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(N) applications of the predicate on average,
+    ///                     where N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which should be put in its
+    ///                     final position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    nth_element(ExPolicy&& policy, RandomIt first, RandomIt nth,
+        RandomIt last, Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -0,0 +1,361 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_COPY_2020)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_COPY_2020
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Adds the elements [first, first + count) to the max-heap holding
+        // the k smallest elements seen so far.
+        template <typename T, typename FwdIter, typename Compare>
+        void partial_sort_copy_push(std::vector<T>& heap, std::size_t k,
+            FwdIter first, std::size_t count, Compare const& comp)
+        {
+            for (/**/; count != 0; (void) ++first, --count)
+            {
+                if (heap.size() < k)
+                {
+                    heap.push_back(*first);
+                    std::push_heap(heap.begin(), heap.end(), comp);
+                }
+                else if (comp(*first, heap.front()))
+                {
+                    std::pop_heap(heap.begin(), heap.end(), comp);
+                    heap.back() = *first;
+                    std::push_heap(heap.begin(), heap.end(), comp);
+                }
+            }
+        }
+
+        // Returns the k smallest elements of [first, first + count), the
+        // elements are not sorted.
+        template <typename T, typename FwdIter, typename Compare>
+        std::vector<T> partial_sort_copy_heap(FwdIter first, std::size_t count,
+            std::size_t k, Compare const& comp)
+        {
+            std::vector<T> heap;
+            heap.reserve((std::min)(k, count));
+            partial_sort_copy_push(heap, k, first, count, comp);
+            return heap;
+        }
+
+        // Merges the smallest elements of all partitions, returns the k
+        // smallest elements in sorted order.
+        template <typename T, typename Compare>
+        std::vector<T> partial_sort_copy_merge(
+            std::vector<std::vector<T>>&& heaps, std::size_t k,
+            Compare const& comp)
+        {
+            std::vector<T> result;
+            if (heaps.size() == 1)
+            {
+                result = std::move(heaps.front());
+                std::make_heap(result.begin(), result.end(), comp);
+            }
+            else
+            {
+                std::size_t count = 0;
+                for (std::vector<T> const& heap : heaps)
+                    count += heap.size();
+
+                result.reserve((std::min)(k, count));
+                for (std::vector<T>& heap : heaps)
+                {
+                    partial_sort_copy_push(result, k,
+                        std::make_move_iterator(heap.begin()), heap.size(),
+                        comp);
+                }
+            }
+
+            std::sort_heap(result.begin(), result.end(), comp);
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Collects the k smallest elements of a range in sorted order, this
+        // is used for the partitions of segmented ranges.
+        template <typename T>
+        struct partial_sort_copy_candidates
+          : public detail::algorithm<partial_sort_copy_candidates<T>,
+                std::vector<T>>
+        {
+            partial_sort_copy_candidates()
+              : partial_sort_copy_candidates::algorithm(
+                    "partial_sort_copy_candidates")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static std::vector<T> sequential(ExPolicy, FwdIter first,
+                FwdIter last, std::size_t k, Compare&& comp, Proj&& proj)
+            {
+                util::compare_projected<Compare, Proj> comp_projected(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                std::vector<T> result = partial_sort_copy_heap<T>(
+                    first, std::distance(first, last), k, comp_projected);
+                std::sort_heap(result.begin(), result.end(), comp_projected);
+                return result;
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<T>>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                std::size_t k, Compare&& comp, Proj&& proj)
+            {
+                std::size_t const count = std::distance(first, last);
+                if (count == 0 || k == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        std::vector<T>>::get(std::vector<T>());
+                }
+
+                util::compare_projected<Compare, Proj> comp_projected(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                auto f1 = [k, comp_projected](FwdIter it,
+                              std::size_t part_count) -> std::vector<T> {
+                    return partial_sort_copy_heap<T>(
+                        it, part_count, k, comp_projected);
+                };
+                auto f2 = [k, comp_projected](
+                              std::vector<std::vector<T>>&& heaps)
+                    -> std::vector<T> {
+                    return partial_sort_copy_merge(
+                        std::move(heaps), k, comp_projected);
+                };
+
+                return util::partitioner<ExPolicy, std::vector<T>,
+                    std::vector<T>>::call(std::forward<ExPolicy>(policy),
+                    first, count, std::move(f1),
+                    hpx::util::unwrapping(std::move(f2)));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandomIt>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<RandomIt>, RandomIt>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy, FwdIter first, FwdIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+
+            // Each partition collects its smallest elements in a heap, the
+            // heaps are merged at the end.
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                std::size_t const count = std::distance(first, last);
+                std::size_t const k = std::distance(d_first, d_last);
+                if (count == 0 || k == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandomIt>::get(std::move(d_first));
+                }
+
+                util::compare_projected<Compare, Proj> comp_projected(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                auto f1 = [k, comp_projected](FwdIter it,
+                              std::size_t part_count)
+                    -> std::vector<value_type> {
+                    return partial_sort_copy_heap<value_type>(
+                        it, part_count, k, comp_projected);
+                };
+                auto f2 = [d_first, k, comp_projected](
+                              std::vector<std::vector<value_type>>&& heaps)
+                    -> RandomIt {
+                    std::vector<value_type> result = partial_sort_copy_merge(
+                        std::move(heaps), k, comp_projected);
+                    return std::move(result.begin(), result.end(), d_first);
+                };
+
+                return util::partitioner<ExPolicy, RandomIt,
+                    std::vector<value_type>>::call(std::forward<ExPolicy>(
+                                                        policy),
+                    first, count, std::move(f1),
+                    hpx::util::unwrapping(std::move(f2)));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        partial_sort_copy_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj,
+            std::false_type)
+        {
+            typedef std::integral_constant<bool,
+                execution::is_sequenced_execution_policy<ExPolicy>::value ||
+                    !hpx::traits::is_forward_iterator<FwdIter>::value>
+                is_seq;
+
+            return detail::partial_sort_copy<RandomIt>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first, last, d_first,
+                d_last, std::forward<Compare>(comp), std::forward<Proj>(proj));
+        }
+
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename RandomIt,
+            typename Compare, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        partial_sort_copy_(ExPolicy&& policy, SegIter first, SegIter last,
+            RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj,
+            std::true_type);
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal elements
+    /// is not guaranteed to be preserved. The function uses the given
+    /// comparison function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(min(N, M))) applications of the predicate,
+    ///                     where N = std::distance(first, last) and
+    ///                     M = std::distance(d_first, d_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator to the element defining
+    ///           the upper boundary of the sorted range, i.e.
+    ///           d_first + min(last - first, d_last - d_first).
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename FwdIter, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<FwdIter>::value&&
+                    hpx::traits::is_iterator<RandomIt>::value&&
+                        traits::is_projected<Proj, FwdIter>::value&&
+                            traits::is_indirect_callable<ExPolicy, Compare,
+                                traits::projected<Proj, FwdIter>,
+                                traits::projected<Proj, FwdIter>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandomIt d_first, RandomIt d_last, Compare&& comp = Compare(),
+        Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_input_iterator<FwdIter>::value),
+            "Requires at least input iterator.");
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
+
+        return detail::partial_sort_copy_(std::forward<ExPolicy>(policy),
+            first, last, d_first, d_last, std::forward<Compare>(comp),
+            std::forward<Proj>(proj), is_segmented());
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -25,6 +25,7 @@
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/traits/projected.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -215,6 +216,45 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Arithmetic values sorted using the default comparison and no
+        // projection are sorted using a radix sort.
+        template <typename RandomIt, typename Compare, typename Proj>
+        struct use_radix_sort
+          : std::integral_constant<bool,
+                is_radix_sortable<typename std::iterator_traits<
+                    RandomIt>::value_type>::value &&
+                    std::is_same<typename std::iterator_traits<
+                                     RandomIt>::reference,
+                        typename std::iterator_traits<RandomIt>::value_type&>::
+                        value &&
+                    std::is_same<typename hpx::util::decay<Compare>::type,
+                        detail::less>::value &&
+                    std::is_same<typename hpx::util::decay<Proj>::type,
+                        util::projection_identity>::value>
+        {
+        };
+
+        template <typename ExPolicy, typename RandomIt>
+        hpx::future<RandomIt> parallel_radix_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last)
+        {
+            std::size_t const count = last - first;
+            if (count < sort_limit_per_task)
+            {
+                std::sort(first, last);
+                return hpx::make_ready_future(last);
+            }
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            return execution::async_execute(policy.executor(),
+                [first, last, count](policy_type const& policy) -> RandomIt {
+                    radix_sort(policy, first, radix_sort_no_values(), count);
+                    return last;
+                },
+                std::forward<ExPolicy>(policy));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -248,11 +288,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     // call the sort routine and return the right type,
                     // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
+                    return algorithm_result::get(parallel_async(
+                        use_radix_sort<RandomIt, Compare, Proj>(),
                         std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj))));
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
                 }
                 catch (...)
                 {
@@ -261,6 +300,27 @@ namespace hpx { namespace parallel { inline namespace v1 {
                             std::current_exception()));
                 }
             }
+
+        private:
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt> parallel_async(std::false_type,
+                ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                return parallel_sort_async(std::forward<ExPolicy>(policy),
+                    first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt> parallel_async(std::true_type,
+                ExPolicy&& policy, RandomIt first, RandomIt last, Compare&&,
+                Proj&&)
+            {
+                return parallel_radix_sort_async(
+                    std::forward<ExPolicy>(policy), first, last);
+            }
         };
         /// \endcond
     }    // namespace detail
@@ -280,6 +340,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// pointing to an element of the sequence, and
     /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
     ///
+    /// Sequences of integral or floating point values which are sorted
+    /// using the default comparison and projection by a parallel execution
+    /// policy are sorted using a radix sort.
+    ///
     /// \tparam ExPolicy    The type of the execution policy to use (deduced).
     ///                     It describes the manner in which the execution
     ///                     of the algorithm may be parallelized and the manner
@@ -9,14 +9,19 @@
 #define HPX_PARALLEL_ALGORITHM_SORT_BY_KEY_DEC_2015
 
 #include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/util/tagged_pair.hpp>
 
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -35,6 +40,61 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::util::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // radix_sort_by_key
+        template <typename ZipIter>
+        struct radix_sort_by_key
+          : public detail::algorithm<radix_sort_by_key<ZipIter>, ZipIter>
+        {
+            radix_sort_by_key()
+              : radix_sort_by_key::algorithm("radix_sort_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename KeyIter, typename ValueIter>
+            static ZipIter sequential(ExPolicy, KeyIter key_first,
+                KeyIter key_last, ValueIter value_first)
+            {
+                std::size_t const count = std::distance(key_first, key_last);
+                radix_sort(execution::seq, key_first, value_first, count);
+                return hpx::util::make_zip_iterator(
+                    key_last, value_first + count);
+            }
+
+            template <typename ExPolicy, typename KeyIter, typename ValueIter>
+            static typename util::detail::algorithm_result<ExPolicy,
+                ZipIter>::type
+            parallel(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+                ValueIter value_first)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, ZipIter>
+                    algorithm_result;
+                typedef typename std::decay<ExPolicy>::type policy_type;
+
+                try
+                {
+                    std::size_t const count =
+                        std::distance(key_first, key_last);
+                    return algorithm_result::get(
+                        execution::async_execute(policy.executor(),
+                            [key_first, key_last, value_first, count](
+                                policy_type const& policy) -> ZipIter {
+                                radix_sort(
+                                    policy, key_first, value_first, count);
+                                return hpx::util::make_zip_iterator(
+                                    key_last, value_first + count);
+                            },
+                            std::forward<ExPolicy>(policy)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, ZipIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
         /// \endcond
     }    // namespace detail
 
@@ -141,6 +201,94 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<Compare>(comp), detail::extract_key()));
 #endif
     }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts one range of arithmetic keys in ascending order using a radix
+    /// sort, the corresponding elements in the value range are moved to follow
+    /// the sorted order.
+    /// The algorithm is stable, the order of equal keys is preserved. Keys
+    /// are ordered as if by operator<(), negative zero is ordered before
+    /// positive zero for floating point keys.
+    ///
+    /// \note   Complexity: O(N * sizeof(key)), where
+    ///                     N = std::distance(key_first, key_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam KeyIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator, its value type must be an
+    ///                     integral (other than bool) or floating point type.
+    /// \tparam ValueIter   The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator, its value type must be
+    ///                     default constructible and move assignable.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param value_first  Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to, the range
+    ///                     of elements must match [key_first, key_last)
+    ///
+    /// The algorithm allocates temporary storage for a copy of the keys and
+    /// of the values.
+    ///
+    /// The assignments in the parallel \a radix_sort_by_key algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The assignments in the parallel \a radix_sort_by_key algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a radix_sort_by_key algorithm returns a
+    /// \a hpx::future<tagged_pair<tag::in1(KeyIter>, tag::in2(ValueIter)> >
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a
+    ///           \a tagged_pair<tag::in1(KeyIter), tag::in2(ValueIter)>
+    ///           otherwise.
+    ///           The algorithm returns a pair holding an iterator pointing to
+    ///           the first element after the last element in the input key
+    ///           sequence and an iterator pointing to the first element after
+    ///           the last element in the input value sequence.
+    //-----------------------------------------------------------------------------
+
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<KeyIter>::value&&
+                    hpx::traits::is_iterator<ValueIter>::value)>
+    typename util::detail::algorithm_result<ExPolicy,
+        hpx::util::tagged_pair<tag::in1(KeyIter), tag::in2(ValueIter)>>::type
+    radix_sort_by_key(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+        ValueIter value_first)
+    {
+        static_assert((hpx::traits::is_random_access_iterator<KeyIter>::value),
+            "Requires a random access iterator.");
+        static_assert(
+            (hpx::traits::is_random_access_iterator<ValueIter>::value),
+            "Requires a random access iterator.");
+        static_assert((detail::is_radix_sortable<typename std::iterator_traits<
+                          KeyIter>::value_type>::value),
+            "Requires integral or floating point keys.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::util::zip_iterator<KeyIter, ValueIter> zip_iterator;
+
+        return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+            detail::radix_sort_by_key<zip_iterator>().call(
+                std::forward<ExPolicy>(policy), is_seq(), key_first, key_last,
+                value_first));
+    }
 }}}    // namespace hpx::parallel::v1
 
 #endif
@@ -0,0 +1,532 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_2020)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_2020
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/lcos/when_all.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/exception_list.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        // The temporary storage used while merging the sorted runs. Its
+        // elements are constructed by the tasks sorting the initial runs
+        // (each of those constructs the part of the buffer corresponding to
+        // its run), the constructed parts are tracked to be able to clean up
+        // if sorting a run fails.
+        template <typename T>
+        struct stable_sort_buffer
+        {
+            stable_sort_buffer(std::size_t size, std::size_t num_runs)
+              : data_(std::allocator<T>().allocate(size))
+              , size_(size)
+              , constructed_(num_runs, 0)
+            {
+            }
+
+            stable_sort_buffer(stable_sort_buffer const&) = delete;
+            stable_sort_buffer& operator=(stable_sort_buffer const&) = delete;
+
+            ~stable_sort_buffer()
+            {
+                std::allocator<T>().deallocate(data_, size_);
+            }
+
+            T* data_;
+            std::size_t size_;
+            std::vector<char> constructed_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // sequential stable merge moving the elements of both input ranges
+        template <typename Iter1, typename Iter2, typename Compare>
+        void sequential_move_merge(Iter1 first1, Iter1 last1, Iter1 first2,
+            Iter1 last2, Iter2 dest, Compare& comp)
+        {
+            if (first1 != last1 && first2 != last2)
+            {
+                while (true)
+                {
+                    if (comp(*first2, *first1))
+                    {
+                        *dest++ = std::move(*first2++);
+                        if (first2 == last2)
+                            break;
+                    }
+                    else
+                    {
+                        *dest++ = std::move(*first1++);
+                        if (first1 == last1)
+                            break;
+                    }
+                }
+            }
+            dest = std::move(first1, last1, dest);
+            std::move(first2, last2, dest);
+        }
+
+        // Stable merge of [first1, last1) and [first2, last2) into dest. The
+        // larger of both ranges is split at its middle element, the other
+        // range is split at the corresponding position (using lower_bound or
+        // upper_bound to keep equal elements of the first range in front of
+        // the ones of the second range) and both halves are merged
+        // concurrently.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        void parallel_move_merge(ExPolicy const& policy, Iter1 first1,
+            Iter1 last1, Iter1 first2, Iter1 last2, Iter2 dest, Compare& comp,
+            std::size_t chunk_size)
+        {
+            std::size_t const size1 = last1 - first1;
+            std::size_t const size2 = last2 - first2;
+
+            if (size1 + size2 <= chunk_size)
+            {
+                sequential_move_merge(first1, last1, first2, last2, dest, comp);
+                return;
+            }
+
+            Iter1 mid1, mid2;
+            if (size1 >= size2)
+            {
+                mid1 = first1 + size1 / 2;
+                mid2 = lower_bound_helper::call(first2, last2, *mid1, comp,
+                    util::projection_identity());
+            }
+            else
+            {
+                mid2 = first2 + size2 / 2;
+                mid1 = upper_bound_helper::call(first1, last1, *mid2, comp,
+                    util::projection_identity());
+            }
+
+            Iter2 dest_mid = dest + (mid1 - first1) + (mid2 - first2);
+
+            hpx::future<void> left = execution::async_execute(
+                policy.executor(), [&]() -> void {
+                    parallel_move_merge(policy, first1, mid1, first2, mid2,
+                        dest, comp, chunk_size);
+                });
+
+            try
+            {
+                parallel_move_merge(policy, mid1, last1, mid2, last2, dest_mid,
+                    comp, chunk_size);
+            }
+            catch (...)
+            {
+                left.wait();
+
+                std::list<std::exception_ptr> errors;
+                if (left.has_exception())
+                    errors.push_back(left.get_exception_ptr());
+                errors.push_back(std::current_exception());
+
+                throw exception_list(std::move(errors));
+            }
+
+            left.get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sort one of the initial runs, the sorted run is left in the buffer.
+        template <typename RandomIt, typename T, typename Compare>
+        void stable_sort_run(RandomIt first, RandomIt last, T* buffer,
+            std::vector<char>& constructed, std::size_t run, Compare& comp)
+        {
+            std::uninitialized_copy(std::make_move_iterator(first),
+                std::make_move_iterator(last), buffer);
+            constructed[run] = 1;
+
+            std::stable_sort(buffer, buffer + (last - first), comp);
+        }
+
+        //---------------------------------------------------------------------
+        //  function : stable_sort_thread
+        /// \brief Sort the elements [first + lo, first + hi) using a merge
+        ///        sort of the given depth. The sorted elements are left in
+        ///        the buffer if the depth is even and in the original range
+        ///        otherwise.
+        //---------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename T,
+            typename Compare>
+        hpx::future<void> stable_sort_thread(ExPolicy policy, RandomIt first,
+            std::shared_ptr<stable_sort_buffer<T>> buffer, std::size_t lo,
+            std::size_t hi, std::size_t depth, std::size_t run, Compare comp,
+            std::size_t chunk_size)
+        {
+            if (depth == 0)
+            {
+                return execution::async_execute(policy.executor(),
+                    [first, buffer, lo, hi, run,
+                        comp = std::move(comp)]() mutable -> void {
+                        stable_sort_run(first + lo, first + hi,
+                            buffer->data_ + lo, buffer->constructed_, run,
+                            comp);
+                    });
+            }
+
+            std::size_t mid = lo + (hi - lo) / 2;
+
+            // sort both halves concurrently
+            hpx::future<void> left = execution::async_execute(
+                policy.executor(),
+                &stable_sort_thread<ExPolicy, RandomIt, T, Compare>, policy,
+                first, buffer, lo, mid, depth - 1, 2 * run, comp, chunk_size);
+
+            hpx::future<void> right = execution::async_execute(
+                policy.executor(),
+                &stable_sort_thread<ExPolicy, RandomIt, T, Compare>, policy,
+                first, buffer, mid, hi, depth - 1, 2 * run + 1, comp,
+                chunk_size);
+
+            return hpx::dataflow(
+                [policy, first, buffer, lo, mid, hi, depth,
+                    comp = std::move(comp), chunk_size](
+                    hpx::future<void>&& left,
+                    hpx::future<void>&& right) mutable -> void {
+                    if (left.has_exception() || right.has_exception())
+                    {
+                        std::list<std::exception_ptr> errors;
+                        if (left.has_exception())
+                            errors.push_back(left.get_exception_ptr());
+                        if (right.has_exception())
+                            errors.push_back(right.get_exception_ptr());
+
+                        throw exception_list(std::move(errors));
+                    }
+
+                    // merge the sorted halves, moving them between the
+                    // buffer and the original range
+                    T* data = buffer->data_;
+                    if (depth % 2 == 0)
+                    {
+                        parallel_move_merge(policy, first + lo, first + mid,
+                            first + mid, first + hi, data + lo, comp,
+                            chunk_size);
+                    }
+                    else
+                    {
+                        parallel_move_merge(policy, data + lo, data + mid,
+                            data + mid, data + hi, first + lo, comp,
+                            chunk_size);
+                    }
+                },
+                std::move(left), std::move(right));
+        }
+
+        // destroy the elements of the buffer which have been constructed
+        template <typename ExPolicy, typename T>
+        hpx::future<void> destroy_stable_sort_buffer(ExPolicy const& policy,
+            std::shared_ptr<stable_sort_buffer<T>> buffer)
+        {
+            if (std::is_trivially_destructible<T>::value)
+                return hpx::make_ready_future();
+
+            std::size_t const num_runs = buffer->constructed_.size();
+            std::size_t const size = buffer->size_;
+
+            std::vector<hpx::future<void>> destroyed;
+            destroyed.reserve(num_runs);
+
+            // the runs cover the buffer in the same way as in
+            // stable_sort_thread
+            std::vector<std::pair<std::size_t, std::size_t>> runs(1,
+                std::make_pair(std::size_t(0), size));
+            while (runs.size() != num_runs)
+            {
+                std::vector<std::pair<std::size_t, std::size_t>> next;
+                next.reserve(2 * runs.size());
+                for (auto const& r : runs)
+                {
+                    std::size_t mid = r.first + (r.second - r.first) / 2;
+                    next.emplace_back(r.first, mid);
+                    next.emplace_back(mid, r.second);
+                }
+                runs = std::move(next);
+            }
+
+            for (std::size_t i = 0; i != num_runs; ++i)
+            {
+                if (!buffer->constructed_[i])
+                    continue;
+
+                T* first = buffer->data_ + runs[i].first;
+                T* last = buffer->data_ + runs[i].second;
+                destroyed.push_back(execution::async_execute(
+                    policy.executor(), [buffer, first, last]() -> void {
+                        for (T* it = first; it != last; ++it)
+                            it->~T();
+                    }));
+            }
+
+            return hpx::when_all(destroyed).then(hpx::launch::sync,
+                [buffer](hpx::future<std::vector<hpx::future<void>>>&&) {});
+        }
+
+        //---------------------------------------------------------------------
+        //  function : parallel_stable_sort_async
+        //---------------------------------------------------------------------
+        /// @param [in] first : iterator to the first element to sort
+        /// @param [in] last : iterator to the next element after the last
+        /// @param [in] comp : object for to compare
+        /// @remarks The range is split into 2^depth runs which are sorted
+        ///          concurrently and which are then merged pairwise, each
+        ///          merge being performed in parallel. The merges move the
+        ///          elements alternately between the range and a buffer of
+        ///          the same size, the depth is chosen to be odd, such that
+        ///          the last merge moves the elements back into the range.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_stable_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+        {
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            // number of elements to sort
+            std::size_t count = last - first;
+
+            // figure out the chunk size to use
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(), [] { return 0; }, cores,
+                count);
+
+            util::detail::adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // we should not get smaller than our sort_limit_per_task
+            chunk_size = (std::max)(chunk_size, sort_limit_per_task);
+
+            if (count <= chunk_size)
+            {
+                std::stable_sort(first, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+                return hpx::make_ready_future(last);
+
+            // the smallest odd depth creating runs not larger than the chunk
+            // size
+            std::size_t depth = 1;
+            while ((count >> depth) >= chunk_size)
+                ++depth;
+            if (depth % 2 == 0)
+                ++depth;
+
+            auto buffer = std::make_shared<stable_sort_buffer<value_type>>(
+                count, std::size_t(1) << depth);
+
+            hpx::future<void> sorted = execution::async_execute(
+                policy.executor(),
+                &stable_sort_thread<policy_type, RandomIt, value_type, Compare>,
+                policy, first, buffer, std::size_t(0), count, depth,
+                std::size_t(0), comp, chunk_size);
+
+            return sorted.then(hpx::launch::sync,
+                [policy = std::forward<ExPolicy>(policy), buffer, last](
+                    hpx::future<void>&& f) -> hpx::future<RandomIt> {
+                    return destroy_stable_sort_buffer(policy, buffer)
+                        .then(hpx::launch::sync,
+                            [f = std::move(f), last](
+                                hpx::future<void>&&) mutable -> RandomIt {
+                                f.get();    // rethrow exceptions
+                                return last;
+                            });
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    // call the sort routine and return the right type,
+                    // depending on execution policy
+                    return algorithm_result::get(parallel_stable_sort_async(
+                        std::forward<ExPolicy>(policy), first, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// order of equal elements is guaranteed to be preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Iter        The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// The parallel versions of this algorithm use a temporary buffer of the
+    /// same size as the input sequence, the value type of the iterators has
+    /// to be \a MoveConstructible and \a MoveAssignable.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy&& policy, RandomIt first, RandomIt last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -0,0 +1,311 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_UTIL_LOOKBACK_SCAN_PARTITIONER_2020)
+#define HPX_PARALLEL_UTIL_LOOKBACK_SCAN_PARTITIONER_2020
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/yield_while.hpp>
+
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
+#include <hpx/parallel/util/detail/select_partitioner.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // The single pass scan needs random access to its tiles and publishes the
+    // intermediate results of each tile as plain values guarded by a status
+    // flag, which is why it is restricted to trivially copyable types.
+    template <typename T, typename FwdIter>
+    struct is_lookback_scan_supported
+      : std::integral_constant<bool,
+            hpx::traits::is_random_access_iterator<FwdIter>::value &&
+                std::is_trivially_copyable<T>::value &&
+                std::is_default_constructible<T>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // The number of bytes of the sequence covered by one tile. A tile has
+        // to stay in the cache between being reduced and being scanned.
+        static constexpr std::size_t lookback_scan_tile_bytes = 64 * 1024;
+
+        enum lookback_scan_status
+        {
+            lookback_scan_invalid = 0,
+            lookback_scan_aggregate = 1,
+            lookback_scan_prefix = 2
+        };
+
+        template <typename T>
+        struct lookback_scan_tile
+        {
+            lookback_scan_tile()
+              : status(lookback_scan_invalid)
+              , aggregate()
+              , prefix()
+            {
+            }
+
+            std::atomic<int> status;
+            T aggregate;    // reduction of the tile itself
+            T prefix;       // reduction of everything up to the tile's end
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The sequence is split into cache sized tiles which are handed out
+        // in order to one task per core. Each task reduces its tile and
+        // publishes the aggregate, then combines the results published by
+        // its predecessors (stopping at the first full prefix) and finally
+        // scans the still cached tile. This way the sequence is read from
+        // and written to memory exactly once.
+        template <typename ExPolicy, typename R, typename T>
+        struct lookback_scan_static_partitioner
+        {
+            using parameters_type = typename ExPolicy::executor_parameters_type;
+            using executor_type = typename ExPolicy::executor_type;
+
+            using scoped_executor_parameters =
+                detail::scoped_executor_parameters_ref<parameters_type,
+                    executor_type>;
+
+            using handle_local_exceptions =
+                detail::handle_local_exceptions<ExPolicy>;
+
+            using tile_type = hpx::util::cache_aligned_data<
+                lookback_scan_tile<T>>;
+
+            template <typename ExPolicy_, typename FwdIter, typename T_,
+                typename F1, typename F2, typename Op, typename F3>
+            static R call(ExPolicy_ policy, FwdIter first, std::size_t count,
+                T_&& init, F1&& f1, F2&& f2, Op&& op, F3&& f3)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                HPX_ASSERT(count > 0);
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::size_t const tile_size = (std::max)(std::size_t(1),
+                    lookback_scan_tile_bytes / sizeof(value_type));
+                std::size_t const num_tiles =
+                    (count + tile_size - 1) / tile_size;
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.executor(), policy.parameters());
+
+                std::unique_ptr<tile_type[]> tiles(new tile_type[num_tiles]);
+                std::atomic<std::size_t> next_tile(0);
+                std::atomic<bool> failed(false);
+
+                T const initial = std::forward<T_>(init);
+
+                // combines the results of the tiles before tile i, returns
+                // false if any of the other tasks has failed
+                auto look_back = [&](std::size_t i, T& prefix) -> bool {
+                    bool has_prefix = false;
+                    for (std::size_t j = i; j-- != 0; /**/)
+                    {
+                        lookback_scan_tile<T> const& pred = tiles[j].data_;
+
+                        int status = lookback_scan_invalid;
+                        hpx::util::yield_while(
+                            [&]() {
+                                status = pred.status.load(
+                                    std::memory_order_acquire);
+                                return status == lookback_scan_invalid &&
+                                    !failed.load(std::memory_order_relaxed);
+                            },
+                            "lookback_scan_partitioner::look_back");
+
+                        if (status == lookback_scan_invalid)
+                            return false;
+
+                        T const& value = status == lookback_scan_prefix ?
+                            pred.prefix :
+                            pred.aggregate;
+
+                        if (has_prefix)
+                            prefix = hpx::util::invoke(op, value, prefix);
+                        else
+                            prefix = value;
+                        has_prefix = true;
+
+                        if (status == lookback_scan_prefix)
+                            return true;
+                    }
+
+                    // the first tile always publishes its prefix
+                    HPX_ASSERT(false);
+                    return false;
+                };
+
+                auto worker = [&]() {
+                    try
+                    {
+                        for (std::size_t i = next_tile++;
+                             i < num_tiles && !failed; i = next_tile++)
+                        {
+                            std::size_t const offset = i * tile_size;
+                            std::size_t const size =
+                                (std::min)(tile_size, count - offset);
+                            FwdIter it = std::next(first, offset);
+
+                            lookback_scan_tile<T>& tile = tiles[i].data_;
+                            tile.aggregate = hpx::util::invoke(f1, it, size);
+
+                            T prefix = initial;
+                            if (i != 0)
+                            {
+                                tile.status.store(lookback_scan_aggregate,
+                                    std::memory_order_release);
+
+                                if (!look_back(i, prefix))
+                                    return;
+                            }
+
+                            tile.prefix =
+                                hpx::util::invoke(op, prefix, tile.aggregate);
+                            tile.status.store(lookback_scan_prefix,
+                                std::memory_order_release);
+
+                            hpx::util::invoke(f2, it, size, prefix);
+                        }
+                    }
+                    catch (...)
+                    {
+                        // release the tasks waiting for this tile
+                        failed = true;
+                        throw;
+                    }
+                };
+
+                std::vector<hpx::future<void>> workitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    std::size_t const num_workers =
+                        (std::min)(cores, num_tiles);
+                    workitems.reserve(num_workers);
+
+                    for (std::size_t i = 0; i != num_workers; ++i)
+                    {
+                        workitems.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    // the running tasks refer to the local state, make sure
+                    // they have finished before leaving
+                    failed = true;
+                    hpx::wait_all(workitems);
+
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish
+                hpx::wait_all(workitems);
+
+                // always rethrow if 'errors' is not empty or 'workitems' has
+                // an exceptional future
+                handle_local_exceptions::call(workitems, errors);
+
+                try
+                {
+                    return f3();
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_local_exceptions::call(std::current_exception());
+                }
+#endif
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename R, typename T>
+        struct lookback_scan_task_static_partitioner
+        {
+            template <typename ExPolicy_, typename FwdIter, typename T_,
+                typename F1, typename F2, typename Op, typename F3>
+            static hpx::future<R> call(ExPolicy_&& policy, FwdIter first,
+                std::size_t count, T_&& init, F1&& f1, F2&& f2, Op&& op,
+                F3&& f3)
+            {
+                return execution::async_execute(policy.executor(),
+                    [first, count, policy = std::forward<ExPolicy_>(policy),
+                        init = std::forward<T_>(init),
+                        f1 = std::forward<F1>(f1), f2 = std::forward<F2>(f2),
+                        op = std::forward<Op>(op),
+                        f3 = std::forward<F3>(f3)]() mutable -> R {
+                        using partitioner_type =
+                            lookback_scan_static_partitioner<ExPolicy, R, T>;
+                        return partitioner_type::call(
+                            std::forward<ExPolicy_>(policy), first, count,
+                            std::move(init), f1, f2, op, f3);
+                    });
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // ExPolicy:    execution policy
+    // R:           overall result type
+    // T:           type of the per-tile results
+    //
+    // call(policy, first, count, init, f1, f2, op, f3):
+    //  f1(it, size) -> T   reduces a tile
+    //  f2(it, size, T)     scans a tile given the reduction of all elements
+    //                      before it (including init)
+    //  op                  combines two intermediate results
+    //  f3() -> R           produces the overall result
+    template <typename ExPolicy, typename R = void, typename T = R>
+    struct lookback_scan_partitioner
+      : detail::select_partitioner<typename std::decay<ExPolicy>::type,
+            detail::lookback_scan_static_partitioner,
+            detail::lookback_scan_task_static_partitioner>::template apply<R,
+            T>
+    {
+    };
+}}}    // namespace hpx::parallel::util
+
+#endif
@@ -0,0 +1,211 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// large enough to exercise the parallel partitioning
+std::size_t const test_size = (std::size_t(1) << 18) + 13;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_values(std::size_t size, int num_values)
+{
+    std::vector<int> c(size);
+    for (int& value : c)
+        value = std::rand() % num_values;
+    return c;
+}
+
+// nth holds the value it would have if the range was sorted, the range is
+// partitioned around it
+template <typename Compare>
+void verify_nth_element(std::vector<int> const& c, std::vector<int> sorted,
+    std::size_t nth, Compare comp)
+{
+    std::sort(sorted.begin(), sorted.end(), comp);
+    HPX_TEST_EQ(c[nth], sorted[nth]);
+
+    bool partitioned = true;
+    for (std::size_t i = 0; i != c.size() && partitioned; ++i)
+    {
+        if (i < nth && comp(c[nth], c[i]))
+            partitioned = false;
+        else if (i > nth && comp(c[i], c[nth]))
+            partitioned = false;
+    }
+    HPX_TEST(partitioned);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_nth_element(ExPolicy&& policy, int num_values)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t nth :
+        {std::size_t(0), test_size / 2, test_size / 10, test_size - 1})
+    {
+        std::vector<int> c = make_values(test_size, num_values);
+        std::vector<int> const original = c;
+
+        auto result = hpx::parallel::nth_element(
+            policy, c.begin(), c.begin() + nth, c.end());
+
+        HPX_TEST(result == c.end());
+        verify_nth_element(c, original, nth, std::less<int>());
+    }
+}
+
+template <typename ExPolicy>
+void test_nth_element_comp(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+    std::vector<int> const original = c;
+    std::size_t const nth = test_size / 3;
+
+    hpx::parallel::nth_element(policy, c.begin(), c.begin() + nth, c.end(),
+        std::greater<int>());
+
+    verify_nth_element(c, original, nth, std::greater<int>());
+}
+
+template <typename ExPolicy>
+void test_nth_element_proj(ExPolicy&& policy)
+{
+    std::vector<std::pair<int, std::string>> c;
+    c.reserve(test_size);
+    for (int value : make_values(test_size, 1000))
+        c.emplace_back(value, std::to_string(value));
+
+    std::size_t const nth = test_size / 4;
+    hpx::parallel::nth_element(policy, c.begin(), c.begin() + nth, c.end(),
+        std::less<int>(),
+        [](std::pair<int, std::string> const& p) { return p.first; });
+
+    bool partitioned = true;
+    for (std::size_t i = 0; i != c.size() && partitioned; ++i)
+    {
+        if (c[i].second != std::to_string(c[i].first))
+            partitioned = false;
+        else if (i < nth && c[nth].first < c[i].first)
+            partitioned = false;
+        else if (i > nth && c[i].first < c[nth].first)
+            partitioned = false;
+    }
+    HPX_TEST(partitioned);
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+    std::vector<int> const original = c;
+    std::size_t const nth = test_size / 2;
+
+    auto f = hpx::parallel::nth_element(
+        policy, c.begin(), c.begin() + nth, c.end());
+
+    HPX_TEST(f.get() == c.end());
+    verify_nth_element(c, original, nth, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_nth_element_exception(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::nth_element(policy, c.begin(),
+            c.begin() + test_size / 2, c.end(),
+            [](int, int) -> bool { throw std::runtime_error("test"); });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_nth_element()
+{
+    using namespace hpx::parallel;
+
+    // few distinct values exercise the handling of equal elements
+    test_nth_element(execution::seq, 100000);
+    test_nth_element(execution::par, 100000);
+    test_nth_element(execution::par_unseq, 100000);
+    test_nth_element(execution::par, 3);
+    test_nth_element(execution::par, 1);
+
+    test_nth_element_comp(execution::seq);
+    test_nth_element_comp(execution::par);
+
+    test_nth_element_proj(execution::seq);
+    test_nth_element_proj(execution::par);
+
+    test_nth_element_async(execution::seq(execution::task));
+    test_nth_element_async(execution::par(execution::task));
+
+    test_nth_element_exception(execution::par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_nth_element();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,174 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// large enough to exercise the parallel partitioning
+std::size_t const test_size = (std::size_t(1) << 18) + 13;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_values(std::size_t size, int num_values)
+{
+    std::vector<int> c(size);
+    for (int& value : c)
+        value = std::rand() % num_values;
+    return c;
+}
+
+// [first, middle) holds the sorted smallest elements, the remaining elements
+// are not smaller than those
+template <typename Compare>
+void verify_partial_sort(std::vector<int> const& c, std::vector<int> sorted,
+    std::size_t middle, Compare comp)
+{
+    std::sort(sorted.begin(), sorted.end(), comp);
+    HPX_TEST(std::equal(c.begin(), c.begin() + middle, sorted.begin()));
+
+    std::vector<int> rest(c.begin() + middle, c.end());
+    std::sort(rest.begin(), rest.end(), comp);
+    HPX_TEST(std::equal(rest.begin(), rest.end(), sorted.begin() + middle));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy&& policy, int num_values)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t middle :
+        {std::size_t(0), std::size_t(1), std::size_t(100), test_size / 2,
+            test_size})
+    {
+        std::vector<int> c = make_values(test_size, num_values);
+        std::vector<int> const original = c;
+
+        auto result = hpx::parallel::partial_sort(
+            policy, c.begin(), c.begin() + middle, c.end());
+
+        HPX_TEST(result == c.end());
+        verify_partial_sort(c, original, middle, std::less<int>());
+    }
+}
+
+template <typename ExPolicy>
+void test_partial_sort_comp(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+    std::vector<int> const original = c;
+    std::size_t const middle = 1000;
+
+    hpx::parallel::partial_sort(policy, c.begin(), c.begin() + middle,
+        c.end(), std::greater<int>());
+
+    verify_partial_sort(c, original, middle, std::greater<int>());
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+    std::vector<int> const original = c;
+    std::size_t const middle = test_size / 3;
+
+    auto f = hpx::parallel::partial_sort(
+        policy, c.begin(), c.begin() + middle, c.end());
+
+    HPX_TEST(f.get() == c.end());
+    verify_partial_sort(c, original, middle, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_partial_sort_exception(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values(test_size, 100000);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::partial_sort(policy, c.begin(), c.begin() + 100,
+            c.end(),
+            [](int, int) -> bool { throw std::runtime_error("test"); });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_partial_sort()
+{
+    using namespace hpx::parallel;
+
+    test_partial_sort(execution::seq, 100000);
+    test_partial_sort(execution::par, 100000);
+    test_partial_sort(execution::par_unseq, 100000);
+    test_partial_sort(execution::par, 10);
+
+    test_partial_sort_comp(execution::seq);
+    test_partial_sort_comp(execution::par);
+
+    test_partial_sort_async(execution::seq(execution::task));
+    test_partial_sort_async(execution::par(execution::task));
+
+    test_partial_sort_exception(execution::par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_partial_sort();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,176 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const test_size = 100007;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_values(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (int& value : c)
+        value = std::rand();
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy&& policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> const c = make_values(test_size);
+
+    for (std::size_t k : {std::size_t(0), std::size_t(1), std::size_t(100),
+             test_size, test_size + 10})
+    {
+        std::vector<int> d(k);
+        auto result = hpx::parallel::partial_sort_copy(
+            policy, c.begin(), c.end(), d.begin(), d.end());
+
+        std::vector<int> expected(k);
+        auto expected_result = std::partial_sort_copy(
+            c.begin(), c.end(), expected.begin(), expected.end());
+
+        HPX_TEST(result - d.begin() == expected_result - expected.begin());
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_proj(ExPolicy&& policy)
+{
+    std::vector<std::pair<int, std::string>> c;
+    c.reserve(test_size);
+    for (int value : make_values(test_size))
+        c.emplace_back(value, std::to_string(value));
+
+    std::vector<std::pair<int, std::string>> d(1000);
+    hpx::parallel::partial_sort_copy(policy, c.begin(), c.end(), d.begin(),
+        d.end(), std::greater<int>(),
+        [](std::pair<int, std::string> const& p) { return p.first; });
+
+    std::sort(c.begin(), c.end(), std::greater<std::pair<int, std::string>>());
+    bool equal = true;
+    for (std::size_t i = 0; i != d.size() && equal; ++i)
+    {
+        equal = d[i].first == c[i].first &&
+            d[i].second == std::to_string(d[i].first);
+    }
+    HPX_TEST(equal);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy&& policy)
+{
+    std::vector<int> const c = make_values(test_size);
+
+    std::vector<int> d(100);
+    auto f = hpx::parallel::partial_sort_copy(
+        policy, c.begin(), c.end(), d.begin(), d.end());
+
+    std::vector<int> expected(100);
+    std::partial_sort_copy(
+        c.begin(), c.end(), expected.begin(), expected.end());
+
+    HPX_TEST(f.get() == d.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_exception(ExPolicy&& policy)
+{
+    std::vector<int> const c = make_values(test_size);
+    std::vector<int> d(100);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::partial_sort_copy(policy, c.begin(), c.end(),
+            d.begin(), d.end(),
+            [](int, int) -> bool { throw std::runtime_error("test"); });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_partial_sort_copy()
+{
+    using namespace hpx::parallel;
+
+    test_partial_sort_copy(execution::seq);
+    test_partial_sort_copy(execution::par);
+    test_partial_sort_copy(execution::par_unseq);
+
+    test_partial_sort_copy_proj(execution::seq);
+    test_partial_sort_copy_proj(execution::par);
+
+    test_partial_sort_copy_async(execution::seq(execution::task));
+    test_partial_sort_copy_async(execution::par(execution::task));
+
+    test_partial_sort_copy_exception(execution::par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_partial_sort_copy();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
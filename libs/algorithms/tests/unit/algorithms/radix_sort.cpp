@@ -0,0 +1,233 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// large enough to be sorted using more than one chunk
+std::size_t const test_size = (std::size_t(1) << 18) + 13;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T random_value()
+{
+    // use all bits of the value, including the sign bit
+    std::uint64_t bits = 0;
+    for (int i = 0; i != 4; ++i)
+        bits = (bits << 16) ^ std::uint64_t(std::rand());
+    return T(bits);
+}
+
+template <>
+double random_value<double>()
+{
+    return (std::rand() - RAND_MAX / 2) * 1.0e-3 * std::rand();
+}
+
+template <>
+float random_value<float>()
+{
+    return float(random_value<double>());
+}
+
+template <typename T>
+std::vector<T> make_values(std::size_t size)
+{
+    std::vector<T> c(size);
+    for (T& value : c)
+        value = random_value<T>();
+
+    // add a couple of special values
+    if (size > 3)
+    {
+        c[0] = (std::numeric_limits<T>::max)();
+        c[1] = std::numeric_limits<T>::lowest();
+        c[2] = T(0);
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_radix_sort(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<T> c = make_values<T>(size);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::sort(policy, c.begin(), c.end());
+
+    HPX_TEST(result == c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_radix_sort(ExPolicy&& policy)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(100),
+             test_size})
+    {
+        test_radix_sort<ExPolicy, std::uint8_t>(policy, size);
+        test_radix_sort<ExPolicy, std::int16_t>(policy, size);
+        test_radix_sort<ExPolicy, int>(policy, size);
+        test_radix_sort<ExPolicy, unsigned>(policy, size);
+        test_radix_sort<ExPolicy, std::int64_t>(policy, size);
+        test_radix_sort<ExPolicy, std::uint64_t>(policy, size);
+        test_radix_sort<ExPolicy, float>(policy, size);
+        test_radix_sort<ExPolicy, double>(policy, size);
+    }
+}
+
+template <typename ExPolicy>
+void test_radix_sort_skipped_passes(ExPolicy&& policy)
+{
+    // only the lowest digit differs, all other passes are skipped
+    std::vector<std::int64_t> c(test_size);
+    for (std::int64_t& value : c)
+        value = (std::int64_t(1) << 40) + std::rand() % 256;
+
+    std::vector<std::int64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(c == expected);
+
+    // all passes are skipped
+    std::fill(c.begin(), c.end(), std::int64_t(42));
+    hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(std::all_of(c.begin(), c.end(),
+        [](std::int64_t value) { return value == 42; }));
+}
+
+template <typename ExPolicy>
+void test_radix_sort_async(ExPolicy&& policy)
+{
+    std::vector<int> c = make_values<int>(test_size);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::parallel::sort(policy, c.begin(), c.end());
+
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_radix_sort_by_key(ExPolicy&& policy)
+{
+    // few distinct keys, the values record the original positions
+    std::vector<int> keys(test_size);
+    std::vector<std::string> values(test_size);
+    for (std::size_t i = 0; i != test_size; ++i)
+    {
+        keys[i] = std::rand() % 1000 - 500;
+        values[i] = std::to_string(i);
+    }
+    std::vector<int> const original_keys = keys;
+
+    auto result = hpx::parallel::radix_sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(result.in1() == keys.end());
+    HPX_TEST(result.in2() == values.end());
+
+    bool stable = true;
+    for (std::size_t i = 0; i != test_size && stable; ++i)
+    {
+        std::size_t const pos = std::stoul(values[i]);
+        if (original_keys[pos] != keys[i])
+            stable = false;
+        else if (i != 0 && keys[i - 1] > keys[i])
+            stable = false;
+        else if (i != 0 && keys[i - 1] == keys[i] &&
+            std::stoul(values[i - 1]) > pos)
+            stable = false;
+    }
+    HPX_TEST(stable);
+}
+
+template <typename ExPolicy>
+void test_radix_sort_by_key_async(ExPolicy&& policy)
+{
+    std::vector<double> keys = make_values<double>(test_size);
+    std::vector<double> values = keys;
+
+    auto f = hpx::parallel::radix_sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+    f.wait();
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    HPX_TEST(keys == values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_radix_sort()
+{
+    using namespace hpx::parallel;
+
+    test_radix_sort(execution::seq);
+    test_radix_sort(execution::par);
+    test_radix_sort(execution::par_unseq);
+
+    test_radix_sort_skipped_passes(execution::par);
+
+    test_radix_sort_async(execution::seq(execution::task));
+    test_radix_sort_async(execution::par(execution::task));
+
+    test_radix_sort_by_key(execution::seq);
+    test_radix_sort_by_key(execution::par);
+    test_radix_sort_by_key(execution::par_unseq);
+
+    test_radix_sort_by_key_async(execution::seq(execution::task));
+    test_radix_sort_by_key_async(execution::par(execution::task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_radix_sort();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,236 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// large enough to be split into many tiles
+std::size_t const test_size = (std::size_t(1) << 20) + 7;
+
+///////////////////////////////////////////////////////////////////////////////
+// The composition of affine maps is associative but not commutative, any
+// tile combined out of order changes the result.
+struct affine
+{
+    std::uint32_t a;
+    std::uint32_t b;
+};
+
+bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{rhs.a * lhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+std::vector<affine> make_values(std::size_t size)
+{
+    std::vector<affine> c(size);
+    for (affine& value : c)
+    {
+        value.a = std::uint32_t(std::rand()) | 1;
+        value.b = std::uint32_t(std::rand());
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_inclusive_scan_lookback(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<affine> c = make_values(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    affine const init{3, 7};
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose());
+
+    auto result = hpx::parallel::inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), init);
+
+    HPX_TEST(result == d.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_exclusive_scan_lookback(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<affine> c = make_values(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    affine const init{3, 7};
+    hpx::parallel::v1::detail::sequential_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose());
+
+    auto result = hpx::parallel::exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose());
+
+    HPX_TEST(result == d.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_scan_lookback(ExPolicy&& policy)
+{
+    for (std::size_t size : {std::size_t(1), std::size_t(100), test_size})
+    {
+        test_inclusive_scan_lookback(policy, size);
+        test_exclusive_scan_lookback(policy, size);
+    }
+}
+
+template <typename ExPolicy>
+void test_scan_lookback_async(ExPolicy&& policy)
+{
+    std::vector<affine> c = make_values(test_size);
+    std::vector<affine> d(test_size);
+    std::vector<affine> expected(test_size);
+
+    affine const init{1, 0};
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose());
+
+    auto f = hpx::parallel::inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), init);
+
+    HPX_TEST(f.get() == d.end());
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// std::string is not trivially copyable and uses the two pass algorithm
+template <typename ExPolicy>
+void test_scan_fallback(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+    std::vector<std::string> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::string(1, char('a' + std::rand() % 26));
+
+    std::vector<std::string> d(size);
+    std::vector<std::string> expected(size);
+
+    auto op = [](std::string const& lhs, std::string const& rhs) {
+        return lhs + rhs;
+    };
+
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), std::string(), op);
+    hpx::parallel::inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), op, std::string());
+    HPX_TEST(d == expected);
+
+    hpx::parallel::v1::detail::sequential_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), std::string(), op);
+    hpx::parallel::exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), std::string(), op);
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_scan_lookback_exception(ExPolicy&& policy)
+{
+    std::vector<affine> c = make_values(test_size);
+    std::vector<affine> d(test_size);
+
+    // throw from a tile in the middle of the sequence, the tasks waiting for
+    // its results have to give up
+    c[test_size / 2].a = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            [](affine const& lhs, affine const& rhs) {
+                if (lhs.a == 0 || rhs.a == 0)
+                    throw std::runtime_error("test");
+                return compose()(lhs, rhs);
+            },
+            affine{1, 0});
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_scan_lookback()
+{
+    using namespace hpx::parallel;
+
+    test_scan_lookback(execution::par);
+    test_scan_lookback(execution::par_unseq);
+
+    test_scan_lookback_async(execution::par(execution::task));
+
+    test_scan_fallback(execution::par);
+    test_scan_fallback(execution::par(execution::task));
+
+    test_scan_lookback_exception(execution::par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_scan_lookback();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
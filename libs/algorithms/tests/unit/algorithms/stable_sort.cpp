@@ -0,0 +1,216 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/container_algorithms/sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// large enough to exercise the parallel merge phase
+std::size_t const test_size = (std::size_t(1) << 18) + 13;
+
+///////////////////////////////////////////////////////////////////////////////
+// elements with few distinct keys, remembering their original position
+struct record
+{
+    int key;
+    std::size_t pos;
+    std::string payload;
+};
+
+std::vector<record> make_records(std::size_t size, int num_keys)
+{
+    std::vector<record> c;
+    c.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c.push_back(record{std::rand() % num_keys, i, std::to_string(i)});
+    }
+    return c;
+}
+
+// the keys are ordered and equal keys keep their original order
+template <typename Compare>
+void verify_stable(std::vector<record> const& c, Compare comp)
+{
+    bool stable = true;
+    for (std::size_t i = 1; i < c.size() && stable; ++i)
+    {
+        if (comp(c[i].key, c[i - 1].key))
+            stable = false;
+        else if (!comp(c[i - 1].key, c[i].key) && c[i - 1].pos > c[i].pos)
+            stable = false;
+        else if (c[i].payload != std::to_string(c[i].pos))
+            stable = false;
+    }
+    HPX_TEST(stable);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy&& policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<record> c = make_records(test_size, 100);
+
+    auto result = hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        std::less<int>(), [](record const& r) { return r.key; });
+
+    HPX_TEST(result == c.end());
+    verify_stable(c, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_stable_sort_comp(ExPolicy&& policy)
+{
+    std::vector<record> c = make_records(test_size, 1000);
+
+    hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        [](record const& lhs, record const& rhs) {
+            return lhs.key > rhs.key;
+        });
+
+    verify_stable(c, std::greater<int>());
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy&& policy)
+{
+    std::vector<record> c = make_records(test_size, 10);
+
+    auto f = hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        std::less<int>(), [](record const& r) { return r.key; });
+
+    HPX_TEST(f.get() == c.end());
+    verify_stable(c, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_stable_sort_range(ExPolicy&& policy)
+{
+    std::vector<record> c = make_records(test_size, 100);
+
+    hpx::parallel::stable_sort(
+        policy, c, std::less<int>(), [](record const& r) { return r.key; });
+
+    verify_stable(c, std::less<int>());
+}
+
+template <typename ExPolicy>
+void test_stable_sort_sorted(ExPolicy&& policy)
+{
+    std::vector<int> c(test_size);
+    for (std::size_t i = 0; i != c.size(); ++i)
+        c[i] = int(i / 3);
+
+    hpx::parallel::stable_sort(policy, c.begin(), c.end());
+    for (std::size_t i = 0; i != c.size(); ++i)
+        HPX_TEST_EQ(c[i], int(i / 3));
+
+    // sort in reverse order
+    hpx::parallel::stable_sort(policy, c.begin(), c.end(), std::greater<int>());
+    for (std::size_t i = 0; i != c.size(); ++i)
+        HPX_TEST_EQ(c[i], int((c.size() - i - 1) / 3));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy&& policy)
+{
+    std::vector<record> c = make_records(test_size, 100);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+            [](record const&, record const&) -> bool {
+                throw std::runtime_error("test");
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stable_sort()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort(execution::seq);
+    test_stable_sort(execution::par);
+    test_stable_sort(execution::par_unseq);
+
+    test_stable_sort_comp(execution::seq);
+    test_stable_sort_comp(execution::par);
+    test_stable_sort_comp(execution::par_unseq);
+
+    test_stable_sort_async(execution::seq(execution::task));
+    test_stable_sort_async(execution::par(execution::task));
+
+    test_stable_sort_range(execution::seq);
+    test_stable_sort_range(execution::par);
+
+    test_stable_sort_sorted(execution::seq);
+    test_stable_sort_sorted(execution::par);
+
+    test_stable_sort_exception(execution::par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_stable_sort();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -17,11 +17,16 @@
 #define CHECKPOINT_HPP_07262017
 
 #include <hpx/dataflow.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/hashing/crc32c.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/new.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/naming_fwd.hpp>
+#include <hpx/runtime/threads/run_as_os_thread.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/traits/is_client.hpp>
@@ -30,6 +35,7 @@
 #include <cstdint>
 #include <fstream>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -240,25 +246,95 @@ namespace hpx { namespace util {
             return hpx::get_ptr<server_type>(c.get_id());
         }
 
+        // The CRC-32C of the archive data is stored as 4 little endian bytes
+        // after the end of the archive, followed by a marker identifying the
+        // format. The marker is kept outside of the archive flags as those
+        // could be corrupted themselves.
+        constexpr std::size_t checksum_size = sizeof(std::uint32_t);
+        constexpr std::size_t marker_size = sizeof(std::uint32_t);
+        constexpr std::uint32_t checksum_marker = 0x4b435848;    // "HXCK"
+
+        inline void append_uint32(std::vector<char>& data, std::uint32_t value)
+        {
+            std::size_t size = data.size();
+            data.resize(size + sizeof(std::uint32_t));
+            for (std::size_t i = 0; i != sizeof(std::uint32_t); ++i)
+            {
+                data[size + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+            }
+        }
+
+        inline std::uint32_t extract_uint32(
+            std::vector<char> const& data, std::size_t pos)
+        {
+            std::uint32_t value = 0;
+            for (std::size_t i = 0; i != sizeof(std::uint32_t); ++i)
+            {
+                value |= std::uint32_t(
+                             static_cast<unsigned char>(data[pos + i]))
+                    << (8 * i);
+            }
+            return value;
+        }
+
+        inline void append_checksum(std::vector<char>& data)
+        {
+            append_uint32(data, util::crc32c(data.data(), data.size()));
+            append_uint32(data, checksum_marker);
+        }
+
+        // returns whether the checkpoint was written with a checksum
+        inline bool has_checksum(std::vector<char> const& data)
+        {
+            return data.size() >= checksum_size + marker_size &&
+                extract_uint32(data, data.size() - marker_size) ==
+                checksum_marker;
+        }
+
+        inline void verify_checksum(std::vector<char> const& data)
+        {
+            if (!has_checksum(data))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "hpx::util::restore_checkpoint",
+                    "checkpoint data is corrupted (missing checksum)");
+            }
+
+            std::size_t size = data.size() - checksum_size - marker_size;
+            if (util::crc32c(data.data(), size) != extract_uint32(data, size))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "hpx::util::restore_checkpoint",
+                    "checkpoint data is corrupted (checksum mismatch)");
+            }
+        }
+
         struct save_funct_obj
         {
             template <typename... Ts>
             checkpoint operator()(checkpoint&& c, Ts&&... ts) const
             {
-                // Create serialization archive from checkpoint data member
-                hpx::serialization::output_archive ar(c.data_);
+                {
+                    // Create serialization archive from checkpoint data
+                    // member, the data is followed by a checksum
+                    hpx::serialization::output_archive ar(
+                        c.data_, hpx::serialization::enable_checksum);
+
+                    // force check-pointing flag to be created in the archive,
+                    // the serialization of id_type's checks for it
+                    ar.get_extra_data<naming::checkpointing_tag>();
 
-                // force check-pointing flag to be created in the archive,
-                // the serialization of id_type's checks for it
-                ar.get_extra_data<naming::checkpointing_tag>();
+                    // Serialize data
 
-                // Serialize data
+                    // Trick to expand the variable pack, akes advantage of the
+                    // comma operator.
+                    int const sequencer[] = {0, (ar << ts, 0)...};
+                    (void) sequencer;    // Suppress unused param. warnings
 
-                // Trick to expand the variable pack, akes advantage of the
-                // comma operator.
-                int const sequencer[] = {0, (ar << ts, 0)...};
-                (void) sequencer;    // Suppress unused param. warnings
+                    ar.flush();
+                }
 
+                append_checksum(c.data_);
                 return std::move(c);
             }
         };
@@ -275,8 +351,9 @@ namespace hpx { namespace util {
     ///                      checkpoint object.
     ///
     /// \tparam U            This parameter is used to make sure that T
-    ///                      is not a launch policy or a checkpoint. This
-    ///                      forces the compiler to choose the correct overload.
+    ///                      is not a launch policy, an execution policy, or a
+    ///                      checkpoint. This forces the compiler to choose the
+    ///                      correct overload.
     ///
     /// \param t             A container to restore.
     ///
@@ -301,6 +378,7 @@ namespace hpx { namespace util {
     template <typename T, typename... Ts,
         typename U =
             typename std::enable_if<!hpx::traits::is_launch_policy<T>::value &&
+                !hpx::parallel::execution::is_execution_policy<T>::value &&
                 !std::is_same<typename std::decay<T>::type,
                     checkpoint>::value>::type>
     hpx::future<checkpoint> save_checkpoint(T&& t, Ts&&... ts)
@@ -596,6 +674,13 @@ namespace hpx { namespace util {
         // Create serialization archive
         hpx::serialization::input_archive ar(c.data_, c.size());
 
+        // checkpoints written by older versions don't carry a checksum, the
+        // archive flags are only consulted in addition to the marker
+        if (detail::has_checksum(c.data_) || ar.enable_checksum())
+        {
+            detail::verify_checksum(c.data_);
+        }
+
         // De-serialize data
         detail::restore_impl(ar, t);
 
@@ -605,6 +690,357 @@ namespace hpx { namespace util {
         (void) sequencer;    // Suppress unused variable warnings
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Serialize a single segment of a range
+        template <typename Executor, typename T>
+        typename std::enable_if<!hpx::traits::is_client<T>::value,
+            hpx::future<checkpoint>>::type
+        save_segment(Executor& exec, T const& t)
+        {
+            return hpx::parallel::execution::async_execute(
+                exec, [&t]() { return save_funct_obj{}(checkpoint{}, t); });
+        }
+
+        template <typename Executor, typename Client, typename Server>
+        hpx::future<checkpoint> save_segment(Executor&,
+            hpx::components::client_base<Client, Server> const& c)
+        {
+            return hpx::dataflow(save_funct_obj{}, checkpoint{}, prep(c));
+        }
+
+        // Compute the offsets of the given checkpoints in a file, each
+        // checkpoint is preceded by its size (see operator<<)
+        inline std::vector<std::uint64_t> checkpoint_offsets(
+            std::vector<checkpoint> const& checkpoints)
+        {
+            std::vector<std::uint64_t> offsets;
+            offsets.reserve(checkpoints.size());
+
+            std::uint64_t offset = 0;
+            for (checkpoint const& c : checkpoints)
+            {
+                offsets.push_back(offset);
+                offset += sizeof(std::int64_t) + c.size();
+            }
+            return offsets;
+        }
+
+        // Compute the offsets of the checkpoints stored in the given file by
+        // skipping their data, the stored sizes are verified to lie within
+        // the file.
+        inline std::vector<std::uint64_t> read_checkpoint_offsets(
+            std::string const& filename)
+        {
+            std::ifstream is(filename, std::ios::binary | std::ios::ate);
+            if (!is)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::read_checkpoints",
+                    "failed to open checkpoint file: " + filename);
+            }
+
+            std::uint64_t const file_size = std::uint64_t(is.tellg());
+            is.seekg(0);
+
+            std::vector<std::uint64_t> offsets;
+
+            std::uint64_t offset = 0;
+            std::int64_t size = 0;
+            while (is.read(reinterpret_cast<char*>(&size), sizeof(size)))
+            {
+                std::uint64_t const available =
+                    file_size - offset - sizeof(std::int64_t);
+                if (size < 0 || std::uint64_t(size) > available)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "hpx::util::read_checkpoints",
+                        "invalid checkpoint size stored in checkpoint "
+                        "file: " + filename);
+                }
+
+                offsets.push_back(offset);
+                offset += sizeof(std::int64_t) + size;
+                is.seekg(std::streamoff(offset));
+            }
+
+            if (is.gcount() != 0)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::read_checkpoints",
+                    "truncated checkpoint file: " + filename);
+            }
+            return offsets;
+        }
+
+        inline void wait_all_segments(
+            hpx::future<std::vector<hpx::future<void>>>&& f)
+        {
+            // propagate exceptions
+            for (hpx::future<void>& segment : f.get())
+                segment.get();
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Parallel overload
+    ///
+    /// \tparam ExPolicy     The execution policy used to schedule the
+    ///                      serialization of the segments.
+    ///
+    /// \tparam Range        A range of containers (or clients) to be
+    ///                      serialized.
+    ///
+    /// \param policy        The execution policy to use.
+    ///
+    /// \param segments      The range of objects to serialize. The range and
+    ///                      its elements must not be modified (or destroyed)
+    ///                      before the returned future has become ready.
+    ///
+    /// This overload serializes each element of the given range into a
+    /// separate checkpoint. The elements are serialized concurrently using
+    /// the executor of the given execution policy.
+    ///
+    /// \returns Save_checkpoint returns a future to a vector holding one
+    ///          checkpoint per element of the given range.
+    template <typename ExPolicy, typename Range,
+        typename U = typename std::enable_if<
+            hpx::parallel::execution::is_execution_policy<ExPolicy>::value>::
+            type>
+    hpx::future<std::vector<checkpoint>> save_checkpoint(
+        ExPolicy&& policy, Range const& segments)
+    {
+        auto exec = policy.executor();
+
+        std::vector<hpx::future<checkpoint>> futures;
+        futures.reserve(std::distance(std::begin(segments), std::end(segments)));
+
+        for (auto const& segment : segments)
+        {
+            futures.push_back(detail::save_segment(exec, segment));
+        }
+
+        return hpx::when_all(futures).then(
+            [](hpx::future<std::vector<hpx::future<checkpoint>>>&& f) {
+                std::vector<hpx::future<checkpoint>> futures = f.get();
+
+                std::vector<checkpoint> checkpoints;
+                checkpoints.reserve(futures.size());
+                for (hpx::future<checkpoint>& c : futures)
+                {
+                    checkpoints.push_back(c.get());
+                }
+                return checkpoints;
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint - Parallel overload
+    ///
+    /// \tparam ExPolicy     The execution policy used to schedule the
+    ///                      de-serialization of the segments.
+    ///
+    /// \tparam Range        A range of containers (or clients) to restore.
+    ///
+    /// \param policy        The execution policy to use.
+    ///
+    /// \param checkpoints   The checkpoints created by the parallel overload
+    ///                      of save_checkpoint.
+    ///
+    /// \param segments      The range of objects to restore, it has to have
+    ///                      as many elements as there are checkpoints.
+    ///
+    /// The checkpoints and the range have to be kept alive until the returned
+    /// future has become ready.
+    ///
+    /// \returns Restore_checkpoint returns a future which becomes ready once
+    ///          all elements of the range have been restored.
+    template <typename ExPolicy, typename Range,
+        typename U = typename std::enable_if<
+            hpx::parallel::execution::is_execution_policy<ExPolicy>::value>::
+            type>
+    hpx::future<void> restore_checkpoint(ExPolicy&& policy,
+        std::vector<checkpoint> const& checkpoints, Range& segments)
+    {
+        if (std::size_t(std::distance(std::begin(segments),
+                std::end(segments))) != checkpoints.size())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::util::restore_checkpoint",
+                "the number of checkpoints does not match the number of "
+                "segments to restore");
+        }
+
+        auto exec = policy.executor();
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(checkpoints.size());
+
+        auto it = std::begin(segments);
+        for (checkpoint const& c : checkpoints)
+        {
+            auto& segment = *it++;
+            futures.push_back(hpx::parallel::execution::async_execute(
+                exec, [&c, &segment]() { restore_checkpoint(c, segment); }));
+        }
+
+        return hpx::when_all(futures).then(&detail::wait_all_segments);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Write_checkpoints
+    ///
+    /// \tparam ExPolicy     The execution policy, its executor runs the
+    ///                      tasks issuing the writes. The file itself is
+    ///                      accessed from the I/O thread pool to not block
+    ///                      HPX worker threads.
+    ///
+    /// \param policy        The execution policy to use.
+    ///
+    /// \param filename      The name of the file to write to, the file is
+    ///                      overwritten.
+    ///
+    /// \param checkpoints   The checkpoints to write, they have to be kept
+    ///                      alive until the returned future has become ready.
+    ///
+    /// Write_checkpoints writes the given checkpoints into the same file, each
+    /// at its own offset. The checkpoints are written concurrently, the
+    /// file has the same layout as if the checkpoints were written one after
+    /// another using operator<<.
+    ///
+    /// \returns Write_checkpoints returns a future which becomes ready once
+    ///          all checkpoints have been written.
+    template <typename ExPolicy,
+        typename U = typename std::enable_if<
+            hpx::parallel::execution::is_execution_policy<ExPolicy>::value>::
+            type>
+    hpx::future<void> write_checkpoints(ExPolicy&& policy,
+        std::string const& filename, std::vector<checkpoint> const& checkpoints)
+    {
+        // create (or truncate) the file up front
+        hpx::future<void> created = hpx::threads::run_as_os_thread(
+            [filename]() {
+                std::ofstream os(
+                    filename, std::ios::binary | std::ios::trunc);
+                if (!os)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "hpx::util::write_checkpoints",
+                        "failed to create checkpoint file: " + filename);
+                }
+            });
+
+        auto exec = policy.executor();
+
+        return created.then(exec, [filename, &checkpoints](
+                                      hpx::future<void>&& f) {
+            f.get();    // propagate exceptions
+
+            std::vector<std::uint64_t> offsets =
+                detail::checkpoint_offsets(checkpoints);
+
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(checkpoints.size());
+
+            for (std::size_t i = 0; i != checkpoints.size(); ++i)
+            {
+                checkpoint const& c = checkpoints[i];
+                std::uint64_t offset = offsets[i];
+
+                futures.push_back(hpx::threads::run_as_os_thread(
+                    [filename, offset, &c]() {
+                        std::ofstream os(filename,
+                            std::ios::binary | std::ios::in | std::ios::out);
+                        os.seekp(std::streamoff(offset));
+                        os << c;
+                        os.flush();
+                        if (!os)
+                        {
+                            HPX_THROW_EXCEPTION(filesystem_error,
+                                "hpx::util::write_checkpoints",
+                                "failed writing to checkpoint file: " +
+                                    filename);
+                        }
+                    }));
+            }
+
+            return hpx::when_all(futures).then(&detail::wait_all_segments);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Read_checkpoints
+    ///
+    /// \tparam ExPolicy     The execution policy, its executor runs the
+    ///                      tasks issuing the reads and collecting the
+    ///                      checkpoints. The file itself is accessed from the
+    ///                      I/O thread pool to not block HPX worker threads.
+    ///
+    /// \param policy        The execution policy to use.
+    ///
+    /// \param filename      The name of the file to read from.
+    ///
+    /// Read_checkpoints reads all checkpoints from a file written by
+    /// write_checkpoints (or by writing checkpoints one after another using
+    /// operator<<). The checkpoints are read concurrently. A
+    /// filesystem_error is reported if the stored sizes of the checkpoints
+    /// don't match the size of the file.
+    ///
+    /// \returns Read_checkpoints returns a future to the checkpoints read.
+    template <typename ExPolicy,
+        typename U = typename std::enable_if<
+            hpx::parallel::execution::is_execution_policy<ExPolicy>::value>::
+            type>
+    hpx::future<std::vector<checkpoint>> read_checkpoints(
+        ExPolicy&& policy, std::string const& filename)
+    {
+        // collect the offsets of all checkpoints by skipping their data
+        hpx::future<std::vector<std::uint64_t>> offsets =
+            hpx::threads::run_as_os_thread([filename]() {
+                return detail::read_checkpoint_offsets(filename);
+            });
+
+        auto exec = policy.executor();
+
+        return offsets.then(exec,
+            [exec, filename](hpx::future<std::vector<std::uint64_t>>&& f) {
+                std::vector<std::uint64_t> offsets = f.get();
+
+                auto checkpoints =
+                    std::make_shared<std::vector<checkpoint>>(offsets.size());
+
+                std::vector<hpx::future<void>> futures;
+                futures.reserve(offsets.size());
+
+                for (std::size_t i = 0; i != offsets.size(); ++i)
+                {
+                    checkpoint& c = (*checkpoints)[i];
+                    std::uint64_t offset = offsets[i];
+
+                    futures.push_back(hpx::threads::run_as_os_thread(
+                        [filename, offset, &c]() {
+                            std::ifstream is(filename, std::ios::binary);
+                            is.seekg(std::streamoff(offset));
+                            is >> c;
+                            if (!is)
+                            {
+                                HPX_THROW_EXCEPTION(filesystem_error,
+                                    "hpx::util::read_checkpoints",
+                                    "failed reading from checkpoint file: " +
+                                        filename);
+                            }
+                        }));
+                }
+
+                return hpx::when_all(futures).then(exec,
+                    [checkpoints](
+                        hpx::future<std::vector<hpx::future<void>>>&& f) {
+                        detail::wait_all_segments(std::move(f));
+                        return std::move(*checkpoints);
+                    });
+            });
+    }
+
 }}    // namespace hpx::util
 
 #endif
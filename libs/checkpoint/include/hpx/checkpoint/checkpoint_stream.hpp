@@ -0,0 +1,731 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+/// This header defines the checkpoint_writer and checkpoint_reader classes.
+/// In contrast to save_checkpoint and restore_checkpoint, they never hold the
+/// serialized state of all objects in memory. The objects are serialized in
+/// chunks which are written to a stream as soon as they are complete, delta
+/// checkpoints store only the chunks which have changed since the previous
+/// checkpoint, and objects can be restored individually.
+
+/// \file hpx/checkpoint/checkpoint_stream.hpp
+
+#if !defined(HPX_CHECKPOINT_STREAM_HPP)
+#define HPX_CHECKPOINT_STREAM_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/runtime/naming_fwd.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The version of the streaming checkpoint format written by
+    /// checkpoint_writer. Readers refuse checkpoints with a newer version.
+    constexpr std::uint32_t checkpoint_stream_version = 1;
+
+    /// The default size of the chunks the serialized objects are split into.
+    /// This is also the granularity used to detect changes while writing
+    /// delta checkpoints.
+    constexpr std::size_t checkpoint_default_chunk_size =
+        std::size_t(1) << 20;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint Manifest
+    ///
+    /// Describes where the chunks of each object stored in a streaming
+    /// checkpoint are located. The manifest is written at the end of each
+    /// checkpoint, the manifest returned by checkpoint_writer::close is used
+    /// as the base of the next delta checkpoint.
+    struct checkpoint_manifest
+    {
+        struct chunk
+        {
+            std::uint64_t hash;          // hash of the chunk's content
+            std::uint64_t offset;        // offset of the chunk's data
+            std::uint32_t size;          // number of bytes in the chunk
+            std::uint32_t generation;    // checkpoint holding the data
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & hash & offset & size & generation;
+                // clang-format on
+            }
+        };
+
+        checkpoint_manifest()
+          : version(checkpoint_stream_version)
+          , generation(0)
+          , chunk_size(checkpoint_default_chunk_size)
+        {
+        }
+
+        std::uint32_t version;
+        std::uint32_t generation;
+        std::uint64_t chunk_size;
+
+        // the chunks of each of the stored objects
+        std::vector<std::vector<chunk>> objects;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & version & generation & chunk_size & objects;
+            // clang-format on
+        }
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A streaming checkpoint consists of a fixed size header, the data of
+        // all chunks written by this checkpoint, the serialized manifest, and
+        // a fixed size trailer holding the size of the manifest.
+        constexpr char checkpoint_stream_magic[8] = {
+            'H', 'P', 'X', 'C', 'K', 'P', 'T', '\0'};
+
+        constexpr std::size_t checkpoint_stream_header_size =
+            sizeof(checkpoint_stream_magic) + 2 * sizeof(std::uint32_t) +
+            sizeof(std::uint64_t);
+
+        constexpr std::size_t checkpoint_stream_trailer_size =
+            sizeof(std::uint64_t) + sizeof(checkpoint_stream_magic);
+
+        // 64 bit hash of the chunk contents (MurmurHash64A)
+        inline std::uint64_t checkpoint_chunk_hash(
+            char const* data, std::size_t size) noexcept
+        {
+            std::uint64_t const m = 0xc6a4a7935bd1e995ULL;
+            int const r = 47;
+
+            std::uint64_t h = 0x8445d61a4e774912ULL ^ (size * m);
+
+            char const* end = data + (size & ~std::size_t(7));
+            for (/**/; data != end; data += 8)
+            {
+                std::uint64_t k;
+                std::memcpy(&k, data, sizeof(k));
+
+                k *= m;
+                k ^= k >> r;
+                k *= m;
+
+                h ^= k;
+                h *= m;
+            }
+
+            std::size_t const tail = size & 7;
+            if (tail != 0)
+            {
+                std::uint64_t k = 0;
+                std::memcpy(&k, data, tail);
+                h ^= k;
+                h *= m;
+            }
+
+            h ^= h >> r;
+            h *= m;
+            h ^= h >> r;
+
+            return h;
+        }
+
+        template <typename T>
+        void write_value(std::ostream& os, T const& value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        void read_value(std::istream& is, T& value)
+        {
+            is.read(reinterpret_cast<char*>(&value), sizeof(T));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Output container handing the serialized data of an object to a
+        // function object in chunks of (at most) the given size.
+        template <typename F>
+        class checkpoint_output_stream
+        {
+        public:
+            checkpoint_output_stream(std::size_t chunk_size, F&& on_chunk)
+              : chunk_size_(chunk_size)
+              , size_(0)
+              , on_chunk_(std::move(on_chunk))
+            {
+                pending_.reserve(chunk_size_);
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void append(void const* address, std::size_t count)
+            {
+                char const* data = static_cast<char const*>(address);
+                while (count != 0)
+                {
+                    std::size_t n =
+                        (std::min)(count, chunk_size_ - pending_.size());
+                    pending_.insert(pending_.end(), data, data + n);
+
+                    if (pending_.size() == chunk_size_)
+                    {
+                        on_chunk_(pending_.data(), pending_.size());
+                        pending_.clear();
+                    }
+
+                    data += n;
+                    count -= n;
+                    size_ += n;
+                }
+            }
+
+            // hand over the last (partial) chunk
+            void finish()
+            {
+                if (!pending_.empty())
+                {
+                    on_chunk_(pending_.data(), pending_.size());
+                    pending_.clear();
+                }
+            }
+
+        private:
+            std::size_t chunk_size_;
+            std::size_t size_;
+            std::vector<char> pending_;
+            F on_chunk_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Input container fetching the chunks of an object on demand using
+        // the given function object.
+        template <typename F>
+        class checkpoint_input_stream
+        {
+        public:
+            checkpoint_input_stream(std::size_t size, F&& get_chunk)
+              : size_(size)
+              , chunk_begin_(0)
+              , next_chunk_(0)
+              , get_chunk_(std::move(get_chunk))
+            {
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void read(void* address, std::size_t count, std::size_t current)
+            {
+                // the data is always consumed sequentially
+                HPX_ASSERT(current >= chunk_begin_);
+
+                char* dest = static_cast<char*>(address);
+                while (count != 0)
+                {
+                    std::size_t offset = current - chunk_begin_;
+                    if (offset == chunk_.size())
+                    {
+                        chunk_begin_ += chunk_.size();
+                        get_chunk_(next_chunk_++, chunk_);
+                        offset = 0;
+                    }
+
+                    std::size_t n = (std::min)(count, chunk_.size() - offset);
+                    std::memcpy(dest, chunk_.data() + offset, n);
+
+                    dest += n;
+                    count -= n;
+                    current += n;
+                }
+            }
+
+        private:
+            std::size_t size_;
+            std::size_t chunk_begin_;
+            std::size_t next_chunk_;
+            std::vector<char> chunk_;
+            F get_chunk_;
+        };
+    }    // namespace detail
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    template <typename F>
+    struct serialization_access_data<util::detail::checkpoint_output_stream<F>>
+      : default_serialization_access_data<
+            util::detail::checkpoint_output_stream<F>>
+    {
+        using container_type = util::detail::checkpoint_output_stream<F>;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        // the data is appended while being written
+        static void resize(container_type&, std::size_t) {}
+
+        static void write(container_type& cont, std::size_t count,
+            std::size_t current, void const* address)
+        {
+            HPX_ASSERT(current == cont.size());
+            cont.append(address, count);
+        }
+    };
+
+    template <typename F>
+    struct serialization_access_data<util::detail::checkpoint_input_stream<F>>
+      : default_serialization_access_data<
+            util::detail::checkpoint_input_stream<F>>
+    {
+        using container_type = util::detail::checkpoint_input_stream<F>;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        static void read(container_type const& cont, std::size_t count,
+            std::size_t current, void* address)
+        {
+            const_cast<container_type&>(cont).read(address, count, current);
+        }
+    };
+}}    // namespace hpx::traits
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint Writer
+    ///
+    /// Serializes objects into a stream (usually a file) one chunk at a time.
+    /// If constructed from the manifest of a previous checkpoint, only those
+    /// chunks are written whose contents differ from the chunk at the same
+    /// position of the same object in the previous checkpoint, all other
+    /// chunks refer to the data stored by the previous checkpoint(s).
+    ///
+    /// The checkpoint is complete only after close has been called, close
+    /// has to be called explicitly as writing the manifest may fail. A
+    /// checkpoint whose writer was destroyed without being closed is rejected
+    /// by the checkpoint_reader.
+    class checkpoint_writer
+    {
+    public:
+        HPX_NON_COPYABLE(checkpoint_writer);
+
+        /// Create a full checkpoint
+        ///
+        /// \param os            The stream to write the checkpoint to.
+        ///
+        /// \param chunk_size    The size of the chunks the objects are
+        ///                      split into.
+        explicit checkpoint_writer(std::ostream& os,
+            std::size_t chunk_size = checkpoint_default_chunk_size)
+          : os_(os)
+          , base_(nullptr)
+          , offset_(0)
+          , closed_(false)
+        {
+            if (chunk_size == 0 || chunk_size > std::uint32_t(-1))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "checkpoint_writer::checkpoint_writer",
+                    "invalid checkpoint chunk size");
+            }
+            manifest_.chunk_size = chunk_size;
+            write_header();
+        }
+
+        /// Create a delta checkpoint
+        ///
+        /// \param os            The stream to write the checkpoint to.
+        ///
+        /// \param base          The manifest of the previous checkpoint, it
+        ///                      has to be kept alive until the writer is
+        ///                      closed.
+        checkpoint_writer(std::ostream& os, checkpoint_manifest const& base)
+          : os_(os)
+          , base_(&base)
+          , offset_(0)
+          , closed_(false)
+        {
+            manifest_.generation = base.generation + 1;
+            manifest_.chunk_size = base.chunk_size;
+            write_header();
+        }
+
+        /// Serialize the given object and append it to the checkpoint.
+        template <typename T>
+        void save(T const& t)
+        {
+            HPX_ASSERT(!closed_);
+
+            std::size_t object = manifest_.objects.size();
+            manifest_.objects.emplace_back();
+
+            auto on_chunk = [this, object](char const* data, std::size_t size) {
+                this->write_chunk(object, data, size);
+            };
+
+            detail::checkpoint_output_stream<decltype(on_chunk)> stream(
+                static_cast<std::size_t>(manifest_.chunk_size),
+                std::move(on_chunk));
+            {
+                hpx::serialization::output_archive ar(stream);
+
+                // force check-pointing flag to be created in the archive,
+                // the serialization of id_type's checks for it
+                ar.get_extra_data<naming::checkpointing_tag>();
+
+                ar << t;
+                ar.flush();
+            }
+            stream.finish();
+
+            if (!os_)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error, "checkpoint_writer::save",
+                    "failed writing to checkpoint stream");
+            }
+        }
+
+        /// Write the manifest, after this no more objects can be saved.
+        ///
+        /// \returns The manifest of this checkpoint, which can be used to
+        ///          create a delta checkpoint based on this one.
+        checkpoint_manifest const& close()
+        {
+            if (closed_)
+                return manifest_;
+            closed_ = true;
+
+            std::vector<char> data;
+            {
+                hpx::serialization::output_archive ar(data);
+                ar << manifest_;
+                ar.flush();
+            }
+
+            os_.write(data.data(), data.size());
+            detail::write_value(os_, std::uint64_t(data.size()));
+            os_.write(detail::checkpoint_stream_magic,
+                sizeof(detail::checkpoint_stream_magic));
+            os_.flush();
+
+            if (!os_)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_writer::close",
+                    "failed writing to checkpoint stream");
+            }
+            return manifest_;
+        }
+
+        /// \returns The number of bytes of object data written by this
+        ///          checkpoint so far (excluding unchanged chunks).
+        std::uint64_t bytes_written() const
+        {
+            return offset_ - detail::checkpoint_stream_header_size;
+        }
+
+    private:
+        void write_header()
+        {
+            os_.write(detail::checkpoint_stream_magic,
+                sizeof(detail::checkpoint_stream_magic));
+            detail::write_value(os_, manifest_.version);
+            detail::write_value(os_, manifest_.generation);
+            detail::write_value(os_, manifest_.chunk_size);
+
+            offset_ = detail::checkpoint_stream_header_size;
+        }
+
+        void write_chunk(std::size_t object, char const* data, std::size_t size)
+        {
+            std::vector<checkpoint_manifest::chunk>& chunks =
+                manifest_.objects[object];
+
+            checkpoint_manifest::chunk c;
+            c.hash = detail::checkpoint_chunk_hash(data, size);
+            c.size = static_cast<std::uint32_t>(size);
+
+            // reuse the data of the previous checkpoint if possible
+            if (base_ != nullptr && object < base_->objects.size() &&
+                chunks.size() < base_->objects[object].size())
+            {
+                checkpoint_manifest::chunk const& b =
+                    base_->objects[object][chunks.size()];
+                if (b.size == c.size && b.hash == c.hash)
+                {
+                    chunks.push_back(b);
+                    return;
+                }
+            }
+
+            c.offset = offset_;
+            c.generation = manifest_.generation;
+            chunks.push_back(c);
+
+            os_.write(data, size);
+            offset_ += size;
+        }
+
+        std::ostream& os_;
+        checkpoint_manifest const* base_;
+        checkpoint_manifest manifest_;
+        std::uint64_t offset_;
+        bool closed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint Reader
+    ///
+    /// Restores objects from a checkpoint written by a checkpoint_writer.
+    /// Only the manifest is read on construction, the data of an object is
+    /// read (chunk by chunk) while it is being restored.
+    class checkpoint_reader
+    {
+    public:
+        HPX_NON_COPYABLE(checkpoint_reader);
+
+        /// Open a full checkpoint
+        ///
+        /// \param is            The stream to read the checkpoint from.
+        explicit checkpoint_reader(std::istream& is)
+          : streams_(1, &is)
+        {
+            read_manifest();
+        }
+
+        /// Open a delta checkpoint
+        ///
+        /// \param chain         The streams holding all checkpoints the
+        ///                      checkpoint to read is based on, starting
+        ///                      with the initial full checkpoint. The last
+        ///                      element refers to the checkpoint to read.
+        explicit checkpoint_reader(std::vector<std::istream*> chain)
+          : streams_(std::move(chain))
+        {
+            if (streams_.empty())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "checkpoint_reader::checkpoint_reader",
+                    "no checkpoint stream given");
+            }
+            read_manifest();
+        }
+
+        checkpoint_manifest const& manifest() const
+        {
+            return manifest_;
+        }
+
+        /// \returns The number of objects stored in the checkpoint.
+        std::size_t size() const
+        {
+            return manifest_.objects.size();
+        }
+
+        /// Restore the object stored at the given position.
+        template <typename T>
+        void restore(std::size_t object, T& t)
+        {
+            if (object >= manifest_.objects.size())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "checkpoint_reader::restore",
+                    "object index out of bounds: " + std::to_string(object));
+            }
+
+            std::vector<checkpoint_manifest::chunk> const& chunks =
+                manifest_.objects[object];
+
+            std::size_t size = 0;
+            for (checkpoint_manifest::chunk const& c : chunks)
+                size += c.size;
+
+            auto get_chunk = [this, &chunks](
+                                 std::size_t i, std::vector<char>& data) {
+                this->read_chunk(chunks, i, data);
+            };
+
+            detail::checkpoint_input_stream<decltype(get_chunk)> stream(
+                size, std::move(get_chunk));
+
+            hpx::serialization::input_archive ar(stream, size);
+            ar >> t;
+        }
+
+    private:
+        void read_manifest()
+        {
+            std::uint32_t const generation =
+                static_cast<std::uint32_t>(streams_.size() - 1);
+
+            // verify the headers of all checkpoints
+            for (std::size_t i = 0; i != streams_.size(); ++i)
+            {
+                std::istream& is = *streams_[i];
+                is.seekg(0, std::ios::beg);
+
+                char magic[sizeof(detail::checkpoint_stream_magic)] = {};
+                std::uint32_t version = 0;
+                std::uint32_t gen = 0;
+                std::uint64_t chunk_size = 0;
+
+                is.read(magic, sizeof(magic));
+                detail::read_value(is, version);
+                detail::read_value(is, gen);
+                detail::read_value(is, chunk_size);
+
+                if (!is ||
+                    std::memcmp(magic, detail::checkpoint_stream_magic,
+                        sizeof(magic)) != 0)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "checkpoint_reader::read_manifest",
+                        "not a checkpoint stream");
+                }
+                if (version > checkpoint_stream_version)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "checkpoint_reader::read_manifest",
+                        "unsupported checkpoint version: " +
+                            std::to_string(version));
+                }
+                if (gen != i)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "checkpoint_reader::read_manifest",
+                        "checkpoint chain is out of order, expected "
+                        "generation " +
+                            std::to_string(i) + ", got " +
+                            std::to_string(gen));
+                }
+            }
+
+            // the manifest of the last checkpoint describes all objects
+            std::istream& is = *streams_.back();
+            is.seekg(-std::streamoff(detail::checkpoint_stream_trailer_size),
+                std::ios::end);
+
+            // the manifest is stored between the header and the trailer
+            std::streamoff const trailer_pos = is.tellg();
+
+            std::uint64_t manifest_size = 0;
+            char magic[sizeof(detail::checkpoint_stream_magic)] = {};
+            detail::read_value(is, manifest_size);
+            is.read(magic, sizeof(magic));
+
+            if (!is ||
+                trailer_pos < std::streamoff(
+                                  detail::checkpoint_stream_header_size) ||
+                std::memcmp(magic, detail::checkpoint_stream_magic,
+                    sizeof(magic)) != 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_manifest",
+                    "incomplete checkpoint stream");
+            }
+
+            if (manifest_size == 0 ||
+                manifest_size > std::uint64_t(trailer_pos -
+                                    detail::checkpoint_stream_header_size))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_manifest",
+                    "invalid checkpoint manifest size: " +
+                        std::to_string(manifest_size));
+            }
+
+            std::vector<char> data(manifest_size);
+            is.seekg(trailer_pos - std::streamoff(manifest_size),
+                std::ios::beg);
+            is.read(data.data(), data.size());
+
+            if (!is)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_manifest",
+                    "failed reading the checkpoint manifest");
+            }
+
+            hpx::serialization::input_archive ar(data, data.size());
+            ar >> manifest_;
+
+            if (manifest_.generation != generation)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_manifest",
+                    "checkpoint chain does not match the manifest");
+            }
+        }
+
+        void read_chunk(std::vector<checkpoint_manifest::chunk> const& chunks,
+            std::size_t i, std::vector<char>& data)
+        {
+            if (i >= chunks.size())
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_chunk",
+                    "checkpoint data is too short");
+            }
+
+            checkpoint_manifest::chunk const& c = chunks[i];
+            if (c.generation >= streams_.size())
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_chunk",
+                    "missing checkpoint for generation " +
+                        std::to_string(c.generation));
+            }
+
+            std::istream& is = *streams_[c.generation];
+            data.resize(c.size);
+            is.seekg(std::streamoff(c.offset), std::ios::beg);
+            is.read(data.data(), data.size());
+
+            if (!is || detail::checkpoint_chunk_hash(data.data(), c.size) !=
+                    c.hash)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_reader::read_chunk",
+                    "corrupted checkpoint data");
+            }
+        }
+
+        std::vector<std::istream*> streams_;
+        checkpoint_manifest manifest_;
+    };
+}}    // namespace hpx::util
+
+#endif
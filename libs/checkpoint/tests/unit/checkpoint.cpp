@@ -13,6 +13,7 @@
 #include <hpx/checkpoint.hpp>
 #include <hpx/testing.hpp>
 
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -225,5 +226,47 @@ int main()
     // Cleanup
     std::remove("test_file_10.txt");
 
+    // Test 11
+    //  test detection of corrupted checkpoints
+    std::vector<double> vec11(100, 3.1415);
+    checkpoint archive11 = save_checkpoint(hpx::launch::sync, vec11);
+
+    std::vector<char> char_vec_11(archive11.begin(), archive11.end());
+    char_vec_11[char_vec_11.size() / 2] ^= 0x01;
+    checkpoint archive11_1(std::move(char_vec_11));
+
+    bool caught_exception = false;
+    try
+    {
+        std::vector<double> vec11_1;
+        restore_checkpoint(archive11_1, vec11_1);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // Test 12
+    //  a corrupted flags word must not disable the verification
+    std::vector<char> char_vec_12(archive11.begin(), archive11.end());
+    for (std::size_t i = 8; i != 12; ++i)
+        char_vec_12[i] = 0;
+    checkpoint archive12(std::move(char_vec_12));
+
+    caught_exception = false;
+    try
+    {
+        std::vector<double> vec12;
+        restore_checkpoint(archive12, vec12);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
     return hpx::util::report_errors();
 }
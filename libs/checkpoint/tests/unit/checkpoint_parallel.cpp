@@ -0,0 +1,152 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the parallel overloads of save_checkpoint and
+// restore_checkpoint, and writing checkpoints to a file concurrently.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::read_checkpoints;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+using hpx::util::write_checkpoints;
+
+std::vector<std::vector<double>> make_segments(std::size_t num_segments)
+{
+    std::vector<std::vector<double>> segments(num_segments);
+    for (std::size_t i = 0; i != num_segments; ++i)
+    {
+        segments[i].resize(1000 + i);
+        for (std::size_t j = 0; j != segments[i].size(); ++j)
+            segments[i][j] = double(i * j);
+    }
+    return segments;
+}
+
+void test_save_restore()
+{
+    std::vector<std::vector<double>> segments = make_segments(16);
+
+    hpx::future<std::vector<checkpoint>> f =
+        save_checkpoint(hpx::parallel::execution::par, segments);
+    std::vector<checkpoint> checkpoints = f.get();
+
+    HPX_TEST_EQ(checkpoints.size(), segments.size());
+
+    std::vector<std::vector<double>> restored(segments.size());
+    restore_checkpoint(hpx::parallel::execution::par, checkpoints, restored)
+        .get();
+
+    HPX_TEST(segments == restored);
+
+    // every segment has been stored in its own checkpoint
+    std::vector<double> segment;
+    restore_checkpoint(checkpoints[3], segment);
+    HPX_TEST(segments[3] == segment);
+}
+
+void test_file()
+{
+    //[checkpoint_parallel_file
+    std::vector<std::vector<double>> segments = make_segments(16);
+    std::vector<checkpoint> checkpoints =
+        save_checkpoint(hpx::parallel::execution::par, segments).get();
+
+    write_checkpoints(hpx::parallel::execution::par, "checkpoint_parallel.dat",
+        checkpoints)
+        .get();
+
+    std::vector<checkpoint> checkpoints1 =
+        read_checkpoints(hpx::parallel::execution::par,
+            "checkpoint_parallel.dat")
+            .get();
+
+    //]
+
+    HPX_TEST(checkpoints == checkpoints1);
+
+    std::vector<std::vector<double>> restored(segments.size());
+    restore_checkpoint(hpx::parallel::execution::par, checkpoints1, restored)
+        .get();
+
+    HPX_TEST(segments == restored);
+
+    // Cleanup
+    std::remove("checkpoint_parallel.dat");
+}
+
+// the stored sizes of the checkpoints have to lie within the file
+void test_corrupt_file(std::int64_t size)
+{
+    {
+        std::ofstream os("checkpoint_corrupt.dat", std::ios::binary);
+        os.write(reinterpret_cast<char const*>(&size), sizeof(size));
+        os.write("data", 4);
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        read_checkpoints(
+            hpx::parallel::execution::par, "checkpoint_corrupt.dat")
+            .get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // Cleanup
+    std::remove("checkpoint_corrupt.dat");
+}
+
+void test_mismatched_segments()
+{
+    std::vector<std::vector<double>> segments = make_segments(4);
+    std::vector<checkpoint> checkpoints =
+        save_checkpoint(hpx::parallel::execution::par, segments).get();
+
+    std::vector<std::vector<double>> restored(2);
+
+    bool caught_exception = false;
+    try
+    {
+        restore_checkpoint(
+            hpx::parallel::execution::par, checkpoints, restored);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_save_restore();
+    test_file();
+    test_corrupt_file(-1);
+    test_corrupt_file(5);
+    test_mismatched_segments();
+
+    return hpx::util::report_errors();
+}
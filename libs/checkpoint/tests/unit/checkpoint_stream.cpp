@@ -0,0 +1,181 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of checkpoint_writer and
+// checkpoint_reader.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_manifest;
+using hpx::util::checkpoint_reader;
+using hpx::util::checkpoint_writer;
+
+constexpr std::size_t chunk_size = 4096;
+
+void test_full_checkpoint()
+{
+    std::vector<double> large(10000);
+    for (std::size_t i = 0; i != large.size(); ++i)
+        large[i] = double(i);
+    std::string str = "I am a string of characters";
+    int integer = 42;
+
+    std::stringstream file;
+    {
+        checkpoint_writer writer(file, chunk_size);
+        writer.save(large);
+        writer.save(str);
+        writer.save(integer);
+
+        checkpoint_manifest const& manifest = writer.close();
+        HPX_TEST_EQ(manifest.objects.size(), std::size_t(3));
+
+        // the large vector is split into several chunks
+        HPX_TEST_LT(std::size_t(1), manifest.objects[0].size());
+    }
+
+    checkpoint_reader reader(file);
+    HPX_TEST_EQ(reader.size(), std::size_t(3));
+
+    // objects can be restored in any order
+    int integer1 = 0;
+    reader.restore(2, integer1);
+    HPX_TEST_EQ(integer, integer1);
+
+    std::vector<double> large1;
+    reader.restore(0, large1);
+    HPX_TEST(large == large1);
+
+    std::string str1;
+    reader.restore(1, str1);
+    HPX_TEST_EQ(str, str1);
+}
+
+void test_delta_checkpoint()
+{
+    //[checkpoint_stream_delta
+    std::vector<std::int64_t> data(100000, 1);
+    std::vector<std::int64_t> small(10, 2);
+
+    std::stringstream file0;
+    checkpoint_writer writer0(file0, chunk_size);
+    writer0.save(data);
+    writer0.save(small);
+    checkpoint_manifest manifest0 = writer0.close();
+    std::uint64_t full_size = writer0.bytes_written();
+
+    // modify a single element, only the chunk holding it has to be written
+    data[data.size() / 2] = 3;
+    small.push_back(4);
+
+    std::stringstream file1;
+    checkpoint_writer writer1(file1, manifest0);
+    writer1.save(data);
+    writer1.save(small);
+    checkpoint_manifest manifest1 = writer1.close();
+
+    HPX_TEST_EQ(manifest1.generation, std::uint32_t(1));
+    HPX_TEST_LT(writer1.bytes_written(), full_size / 10);
+
+    // modify another element, based on the previous delta
+    data[0] = 5;
+
+    std::stringstream file2;
+    checkpoint_writer writer2(file2, manifest1);
+    writer2.save(data);
+    writer2.save(small);
+    writer2.close();
+
+    {
+        checkpoint_reader reader({&file0, &file1, &file2});
+
+        std::vector<std::int64_t> data1;
+        std::vector<std::int64_t> small1;
+        reader.restore(0, data1);
+        reader.restore(1, small1);
+
+        HPX_TEST(data == data1);
+        HPX_TEST(small == small1);
+    }
+    //]
+
+    // the chain has to start with the full checkpoint
+    bool caught_exception = false;
+    try
+    {
+        checkpoint_reader reader({&file1, &file2});
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+template <typename Stream>
+bool throws_serialization_error(Stream& file)
+{
+    try
+    {
+        checkpoint_reader reader(file);
+    }
+    catch (hpx::exception const& e)
+    {
+        return e.get_error() == hpx::serialization_error;
+    }
+    return false;
+}
+
+void test_invalid_checkpoint()
+{
+    std::vector<double> data(1000, 1.0);
+
+    // the manifest is written by close only
+    std::stringstream unclosed;
+    {
+        checkpoint_writer writer(unclosed, chunk_size);
+        writer.save(data);
+    }
+    HPX_TEST(throws_serialization_error(unclosed));
+
+    std::stringstream file;
+    {
+        checkpoint_writer writer(file, chunk_size);
+        writer.save(data);
+        writer.close();
+    }
+
+    // the size of the manifest is stored in front of the trailing magic
+    // number, it must not exceed the size of the stream
+    std::string corrupted = file.str();
+    std::size_t const size_pos = corrupted.size() -
+        hpx::util::detail::checkpoint_stream_trailer_size;
+    for (std::size_t i = 0; i != sizeof(std::uint64_t); ++i)
+        corrupted[size_pos + i] = '\x7f';
+
+    std::stringstream corrupted_file(corrupted);
+    HPX_TEST(throws_serialization_error(corrupted_file));
+}
+
+int main()
+{
+    test_full_checkpoint();
+    test_delta_checkpoint();
+    test_invalid_checkpoint();
+
+    return hpx::util::report_errors();
+}
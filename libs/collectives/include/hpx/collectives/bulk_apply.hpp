@@ -0,0 +1,258 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file bulk_apply.hpp
+
+#if defined(DOXYGEN)
+namespace hpx { namespace lcos {
+
+    /// \brief Apply an action to a large number of targets, aggregating the
+    ///        invocations per destination locality
+    ///
+    /// The function hpx::lcos::bulk_apply performs an asynchronous
+    /// (fire&forget) invocation of the given action on each of the given
+    /// global identifiers, using the corresponding element of \a args as the
+    /// arguments for the invocation. The action can be either a plain action
+    /// (in which case the global identifiers have to refer to localities) or
+    /// a component action (in which case the global identifiers have to refer
+    /// to instances of a component type which exposes the action).
+    ///
+    /// Instead of sending one parcel per target, all invocations which are
+    /// directed to the same locality are sent as a single parcel. The
+    /// receiving locality unpacks those and applies the action to each of its
+    /// targets using a bulk execution on its local thread pool.
+    ///
+    /// \param ids       [in] A list of global identifiers identifying the
+    ///                  target objects for which the given action will be
+    ///                  invoked.
+    /// \param args      [in] A list of argument tuples, one for each of the
+    ///                  given global identifiers.
+    ///
+    /// \note            The target locality of a global identifier is derived
+    ///                  from the identifier itself. Invocations on objects
+    ///                  which have been migrated away from this locality are
+    ///                  forwarded from there.
+    ///
+    template <typename Action>
+    void bulk_apply(std::vector<hpx::id_type> const& ids,
+        std::vector<typename Action::arguments_type> const& args);
+}}    // namespace hpx::lcos
+#else
+
+#ifndef HPX_LCOS_BULK_APPLY_HPP
+#define HPX_LCOS_BULK_APPLY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/apply.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/parallel_executor.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/preprocessor/cat.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/nargs.hpp>
+#include <hpx/runtime/actions/plain_action.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/serialization/tuple.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <boost/range/irange.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_BULK_APPLY_CHUNK_SIZE)
+#define HPX_BULK_APPLY_CHUNK_SIZE 256
+#endif
+
+namespace hpx { namespace lcos {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action>
+        struct bulk_apply_element
+        {
+            template <typename... Ts>
+            void operator()(Ts const&... vs) const
+            {
+                hpx::apply<Action>(id_, vs...);
+            }
+
+            hpx::id_type const& id_;
+        };
+
+        template <typename Action>
+        void bulk_apply_chunk(std::vector<hpx::id_type> const& ids,
+            std::vector<typename Action::arguments_type> const& args,
+            std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                hpx::util::invoke_fused(
+                    bulk_apply_element<Action>{ids[i]}, args[i]);
+            }
+        }
+
+        // Apply the action to all given (local) targets. Larger sets of
+        // targets are split into chunks which are handled concurrently.
+        template <typename Action>
+        void bulk_apply_local(std::vector<hpx::id_type> const& ids,
+            std::vector<typename Action::arguments_type> const& args)
+        {
+            std::size_t const size = ids.size();
+            std::size_t const chunk_size = HPX_BULK_APPLY_CHUNK_SIZE;
+
+            if (size <= chunk_size)
+            {
+                bulk_apply_chunk<Action>(ids, args, 0, size);
+                return;
+            }
+
+            std::size_t const num_chunks = (size + chunk_size - 1) / chunk_size;
+
+            // the chunks only schedule the actual action invocations, so it is
+            // cheap to wait for them which keeps the arguments alive
+            hpx::parallel::execution::parallel_executor exec;
+            std::vector<hpx::future<void>> chunks =
+                hpx::parallel::execution::bulk_async_execute(
+                    exec,
+                    [&](std::size_t chunk) {
+                        std::size_t begin = chunk * chunk_size;
+                        bulk_apply_chunk<Action>(ids, args, begin,
+                            (std::min)(begin + chunk_size, size));
+                    },
+                    boost::irange(std::size_t(0), num_chunks));
+
+            hpx::wait_all(chunks);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action>
+        struct bulk_apply_invoker
+        {
+            static void call(std::vector<hpx::id_type> const& ids,
+                std::vector<typename Action::arguments_type> const& args)
+            {
+                bulk_apply_local<Action>(ids, args);
+            }
+        };
+
+        template <typename Action>
+        struct make_bulk_apply_action
+        {
+            typedef detail::bulk_apply_invoker<Action> bulk_apply_invoker_type;
+
+            typedef typename HPX_MAKE_ACTION(
+                bulk_apply_invoker_type::call)::type type;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Action>
+    void bulk_apply(std::vector<hpx::id_type> const& ids,
+        std::vector<typename Action::arguments_type> const& args)
+    {
+        typedef typename Action::arguments_type arguments_type;
+        typedef typename detail::make_bulk_apply_action<Action>::type
+            bulk_apply_action;
+
+        if (ids.size() != args.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "hpx::lcos::bulk_apply",
+                "mismatched number of targets and arguments");
+            return;
+        }
+
+        // group the invocations by destination locality
+        std::map<std::uint32_t, std::vector<std::size_t>> destinations;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            destinations[naming::get_locality_id_from_id(ids[i])].push_back(i);
+        }
+
+        std::uint32_t const here = hpx::get_locality_id();
+        for (auto const& dest : destinations)
+        {
+            std::vector<hpx::id_type> dest_ids;
+            std::vector<arguments_type> dest_args;
+
+            dest_ids.reserve(dest.second.size());
+            dest_args.reserve(dest.second.size());
+            for (std::size_t i : dest.second)
+            {
+                dest_ids.push_back(ids[i]);
+                dest_args.push_back(args[i]);
+            }
+
+            if (dest.first == here)
+            {
+                detail::bulk_apply_local<Action>(dest_ids, dest_args);
+            }
+            else
+            {
+                hpx::apply<bulk_apply_action>(
+                    naming::get_id_from_locality_id(dest.first),
+                    std::move(dest_ids), std::move(dest_args));
+            }
+        }
+    }
+
+    template <typename Component, typename Signature, typename Derived>
+    void bulk_apply(
+        hpx::actions::basic_action<Component, Signature, Derived> /* act */
+        ,
+        std::vector<hpx::id_type> const& ids,
+        std::vector<typename Derived::arguments_type> const& args)
+    {
+        bulk_apply<Derived>(ids, args);
+    }
+}}    // namespace hpx::lcos
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION(...)                        \
+    HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_(__VA_ARGS__)                   \
+/**/
+#define HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_(...)                       \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_,      \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_1(Action)                   \
+    HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_2(Action, Action)               \
+/**/
+#define HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION_2(Action, Name)             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        ::hpx::lcos::detail::make_bulk_apply_action<Action>::type,             \
+        HPX_PP_CAT(bulk_apply_, Name))                                         \
+/**/
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_BULK_APPLY_ACTION(...)                                    \
+    HPX_REGISTER_BULK_APPLY_ACTION_(__VA_ARGS__)                               \
+/**/
+#define HPX_REGISTER_BULK_APPLY_ACTION_(...)                                   \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_APPLY_ACTION_,                  \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_APPLY_ACTION_1(Action)                               \
+    HPX_REGISTER_BULK_APPLY_ACTION_2(Action, Action)                           \
+/**/
+#define HPX_REGISTER_BULK_APPLY_ACTION_2(Action, Name)                         \
+    HPX_REGISTER_ACTION(                                                       \
+        ::hpx::lcos::detail::make_bulk_apply_action<Action>::type,             \
+        HPX_PP_CAT(bulk_apply_, Name))                                         \
+/**/
+
+#endif
+#endif    // DOXYGEN
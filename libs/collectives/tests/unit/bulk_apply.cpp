@@ -0,0 +1,122 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/collectives.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> invocations(0);
+std::atomic<std::int64_t> sum(0);
+
+void f(std::int64_t value)
+{
+    ++invocations;
+    sum += value;
+}
+HPX_PLAIN_ACTION(f);
+
+HPX_REGISTER_BULK_APPLY_ACTION_DECLARATION(f_action)
+HPX_REGISTER_BULK_APPLY_ACTION(f_action)
+
+std::size_t get_invocations()
+{
+    return invocations.load();
+}
+HPX_PLAIN_ACTION(get_invocations);
+
+std::int64_t get_sum()
+{
+    return sum.load();
+}
+HPX_PLAIN_ACTION(get_sum);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_apply(std::size_t num_per_locality)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::vector<std::size_t> expected_invocations;
+    std::vector<std::int64_t> expected_sum;
+    for (hpx::id_type const& loc : localities)
+    {
+        expected_invocations.push_back(
+            get_invocations_action()(loc) + num_per_locality);
+        expected_sum.push_back(get_sum_action()(loc));
+    }
+
+    // interleave the targets to make sure they are grouped correctly
+    std::vector<hpx::id_type> ids;
+    std::vector<f_action::arguments_type> args;
+    for (std::size_t i = 0; i != num_per_locality; ++i)
+    {
+        for (std::size_t j = 0; j != localities.size(); ++j)
+        {
+            ids.push_back(localities[j]);
+            args.push_back(hpx::util::make_tuple(std::int64_t(i)));
+            expected_sum[j] += std::int64_t(i);
+        }
+    }
+
+    hpx::lcos::bulk_apply<f_action>(ids, args);
+
+    // all invocations are fire&forget, wait for them to arrive
+    for (std::size_t j = 0; j != localities.size(); ++j)
+    {
+        while (get_invocations_action()(localities[j]) !=
+            expected_invocations[j])
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        HPX_TEST_EQ(get_sum_action()(localities[j]), expected_sum[j]);
+    }
+}
+
+void test_mismatched_arguments()
+{
+    std::vector<hpx::id_type> ids(2, hpx::find_here());
+    std::vector<f_action::arguments_type> args(1);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::lcos::bulk_apply<f_action>(ids, args);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    test_bulk_apply(1);
+    test_bulk_apply(10);
+    test_bulk_apply(HPX_BULK_APPLY_CHUNK_SIZE * 4 + 1);
+
+    test_mismatched_arguments();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -176,6 +176,21 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the interval (in milliseconds) after which pending reference
+/// counting requests are sent, independently of their number (0 disables the
+/// timed flush).
+#if !defined(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)
+#  define HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL 100
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the maximum number of names for which a symbol namespace
+/// instance keeps track of the localities having cached the bound id.
+#if !defined(HPX_AGAS_MAX_SYMBOL_CACHE_SUBSCRIPTIONS)
+#  define HPX_AGAS_MAX_SYMBOL_CACHE_SUBSCRIPTIONS 4096
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
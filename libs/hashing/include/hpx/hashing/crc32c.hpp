@@ -0,0 +1,31 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_HASHING_CRC32C_HPP
+#define HPX_HASHING_CRC32C_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util {
+
+    /// Compute the CRC-32C (Castagnoli) checksum of the given data. The
+    /// checksum of data split into several parts can be computed by passing
+    /// the checksum of the preceding parts as \a crc.
+    ///
+    /// The checksum is computed using the SSE4.2 (x86-64) or the ARMv8 CRC32
+    /// instructions if those are available, otherwise a table driven
+    /// implementation processing 8 bytes at a time is used.
+    HPX_EXPORT std::uint32_t crc32c(
+        void const* data, std::size_t size, std::uint32_t crc = 0) noexcept;
+
+    /// Return whether crc32c() uses hardware support
+    HPX_EXPORT bool crc32c_has_hardware_support() noexcept;
+}}    // namespace hpx::util
+
+#endif
@@ -0,0 +1,318 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hashing/crc32c.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define HPX_HASHING_HAVE_SSE42_CRC32C
+#include <nmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define HPX_HASHING_CRC32C_TARGET
+#else
+#define HPX_HASHING_CRC32C_TARGET __attribute__((target("sse4.2")))
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define HPX_HASHING_HAVE_ARMV8_CRC32C
+#include <arm_acle.h>
+#define HPX_HASHING_CRC32C_TARGET
+#endif
+
+namespace hpx { namespace util {
+
+    namespace {
+
+        // CRC-32C polynomial, bit reflected
+        constexpr std::uint32_t crc32c_polynomial = 0x82f63b78;
+
+        ///////////////////////////////////////////////////////////////////////
+        // table driven implementation, processes 8 bytes at a time
+        struct crc32c_tables
+        {
+            crc32c_tables() noexcept
+            {
+                for (std::uint32_t n = 0; n != 256; ++n)
+                {
+                    std::uint32_t crc = n;
+                    for (int k = 0; k != 8; ++k)
+                        crc = (crc & 1) ? (crc >> 1) ^ crc32c_polynomial :
+                                          crc >> 1;
+                    table_[0][n] = crc;
+                }
+
+                for (std::uint32_t n = 0; n != 256; ++n)
+                {
+                    std::uint32_t crc = table_[0][n];
+                    for (int k = 1; k != 8; ++k)
+                    {
+                        crc = (crc >> 8) ^ table_[0][crc & 0xff];
+                        table_[k][n] = crc;
+                    }
+                }
+            }
+
+            std::uint32_t table_[8][256];
+        };
+
+        std::uint32_t load_le32(unsigned char const* p) noexcept
+        {
+            return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) |
+                (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+        }
+
+        std::uint32_t crc32c_sw(
+            std::uint32_t crc, unsigned char const* next, std::size_t len)
+        {
+            static crc32c_tables const tables;
+            auto const& t = tables.table_;
+
+            crc = ~crc;
+            for (/**/; len >= 8; len -= 8, next += 8)
+            {
+                std::uint32_t lo = load_le32(next) ^ crc;
+                std::uint32_t hi = load_le32(next + 4);
+                crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+                    t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+                    t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+                    t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+            }
+            for (/**/; len != 0; --len, ++next)
+                crc = (crc >> 8) ^ t[0][(crc ^ *next) & 0xff];
+            return ~crc;
+        }
+
+#if defined(HPX_HASHING_HAVE_SSE42_CRC32C) ||                                  \
+    defined(HPX_HASHING_HAVE_ARMV8_CRC32C)
+        ///////////////////////////////////////////////////////////////////////
+        // The CRC instructions have a latency of several cycles, the hardware
+        // implementation computes the checksums of three adjacent blocks
+        // concurrently and combines them afterwards (see Mark Adler,
+        // https://stackoverflow.com/a/17646775).
+        constexpr std::size_t long_block = 8192;
+        constexpr std::size_t short_block = 256;
+
+        std::uint32_t gf2_matrix_times(
+            std::uint32_t const* mat, std::uint32_t vec) noexcept
+        {
+            std::uint32_t sum = 0;
+            for (/**/; vec != 0; vec >>= 1, ++mat)
+            {
+                if (vec & 1)
+                    sum ^= *mat;
+            }
+            return sum;
+        }
+
+        void gf2_matrix_square(
+            std::uint32_t* square, std::uint32_t const* mat) noexcept
+        {
+            for (int n = 0; n != 32; ++n)
+                square[n] = gf2_matrix_times(mat, mat[n]);
+        }
+
+        // Table based operator appending len zero bytes to a (raw) checksum,
+        // len has to be a power of two.
+        struct crc32c_shift_table
+        {
+            explicit crc32c_shift_table(std::size_t len) noexcept
+            {
+                // operator for one zero bit
+                std::uint32_t odd[32];
+                odd[0] = crc32c_polynomial;
+                std::uint32_t row = 1;
+                for (int n = 1; n != 32; ++n, row <<= 1)
+                    odd[n] = row;
+
+                // operators for two and four zero bits
+                std::uint32_t even[32];
+                gf2_matrix_square(even, odd);
+                gf2_matrix_square(odd, even);
+
+                // square until the operator for len zero bytes is reached
+                std::uint32_t* op = odd;
+                for (/**/; len != 0; len >>= 1)
+                {
+                    std::uint32_t* other = (op == odd) ? even : odd;
+                    gf2_matrix_square(other, op);
+                    op = other;
+                }
+
+                for (std::uint32_t n = 0; n != 256; ++n)
+                {
+                    zeros_[0][n] = gf2_matrix_times(op, n);
+                    zeros_[1][n] = gf2_matrix_times(op, n << 8);
+                    zeros_[2][n] = gf2_matrix_times(op, n << 16);
+                    zeros_[3][n] = gf2_matrix_times(op, n << 24);
+                }
+            }
+
+            std::uint32_t operator()(std::uint32_t crc) const noexcept
+            {
+                return zeros_[0][crc & 0xff] ^ zeros_[1][(crc >> 8) & 0xff] ^
+                    zeros_[2][(crc >> 16) & 0xff] ^ zeros_[3][crc >> 24];
+            }
+
+            std::uint32_t zeros_[4][256];
+        };
+
+        crc32c_shift_table const& long_shift()
+        {
+            static crc32c_shift_table const table(long_block);
+            return table;
+        }
+
+        crc32c_shift_table const& short_shift()
+        {
+            static crc32c_shift_table const table(short_block);
+            return table;
+        }
+
+#if defined(HPX_HASHING_HAVE_SSE42_CRC32C)
+        struct crc32c_instructions
+        {
+            HPX_HASHING_CRC32C_TARGET static std::uint32_t crc8(
+                std::uint32_t crc, unsigned char value) noexcept
+            {
+                return _mm_crc32_u8(crc, value);
+            }
+
+            HPX_HASHING_CRC32C_TARGET static std::uint32_t crc64(
+                std::uint32_t crc, unsigned char const* p) noexcept
+            {
+                std::uint64_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return static_cast<std::uint32_t>(_mm_crc32_u64(crc, value));
+            }
+        };
+
+        bool has_crc32c_instructions() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 20)) != 0;
+#else
+            return __builtin_cpu_supports("sse4.2");
+#endif
+        }
+#else
+        struct crc32c_instructions
+        {
+            static std::uint32_t crc8(
+                std::uint32_t crc, unsigned char value) noexcept
+            {
+                return __crc32cb(crc, value);
+            }
+
+            static std::uint32_t crc64(
+                std::uint32_t crc, unsigned char const* p) noexcept
+            {
+                std::uint64_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return __crc32cd(crc, value);
+            }
+        };
+
+        constexpr bool has_crc32c_instructions() noexcept
+        {
+            return true;
+        }
+#endif
+
+        // checksum len bytes of three adjacent blocks of block_size bytes
+        template <typename Instr>
+        HPX_HASHING_CRC32C_TARGET std::uint32_t crc32c_blocks(std::uint32_t crc,
+            unsigned char const*& next, std::size_t& len,
+            std::size_t block_size, crc32c_shift_table const& shift) noexcept
+        {
+            while (len >= 3 * block_size)
+            {
+                std::uint32_t crc1 = 0;
+                std::uint32_t crc2 = 0;
+                unsigned char const* end = next + block_size;
+                do
+                {
+                    crc = Instr::crc64(crc, next);
+                    crc1 = Instr::crc64(crc1, next + block_size);
+                    crc2 = Instr::crc64(crc2, next + 2 * block_size);
+                    next += 8;
+                } while (next != end);
+
+                crc = shift(crc) ^ crc1;
+                crc = shift(crc) ^ crc2;
+
+                next += 2 * block_size;
+                len -= 3 * block_size;
+            }
+            return crc;
+        }
+
+        template <typename Instr>
+        HPX_HASHING_CRC32C_TARGET std::uint32_t crc32c_hw(
+            std::uint32_t crc, unsigned char const* next, std::size_t len)
+        {
+            crc = ~crc;
+
+            // align the data for the 8 byte accesses
+            for (/**/; len != 0 && (reinterpret_cast<std::uintptr_t>(next) & 7);
+                 --len, ++next)
+            {
+                crc = Instr::crc8(crc, *next);
+            }
+
+            crc = crc32c_blocks<Instr>(
+                crc, next, len, long_block, long_shift());
+            crc = crc32c_blocks<Instr>(
+                crc, next, len, short_block, short_shift());
+
+            for (/**/; len >= 8; len -= 8, next += 8)
+                crc = Instr::crc64(crc, next);
+
+            for (/**/; len != 0; --len, ++next)
+                crc = Instr::crc8(crc, *next);
+
+            return ~crc;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        using crc32c_function = std::uint32_t (*)(
+            std::uint32_t, unsigned char const*, std::size_t);
+
+        crc32c_function select_crc32c() noexcept
+        {
+#if defined(HPX_HASHING_HAVE_SSE42_CRC32C) ||                                  \
+    defined(HPX_HASHING_HAVE_ARMV8_CRC32C)
+            if (has_crc32c_instructions())
+                return &crc32c_hw<crc32c_instructions>;
+#endif
+            return &crc32c_sw;
+        }
+
+        crc32c_function get_crc32c() noexcept
+        {
+            static crc32c_function const f = select_crc32c();
+            return f;
+        }
+    }    // namespace
+
+    std::uint32_t crc32c(
+        void const* data, std::size_t size, std::uint32_t crc) noexcept
+    {
+        return get_crc32c()(
+            crc, static_cast<unsigned char const*>(data), size);
+    }
+
+    bool crc32c_has_hardware_support() noexcept
+    {
+        return get_crc32c() != &crc32c_sw;
+    }
+}}    // namespace hpx::util
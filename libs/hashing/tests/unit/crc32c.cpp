@@ -0,0 +1,78 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hashing/crc32c.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// bit-wise reference implementation
+std::uint32_t crc32c_reference(unsigned char const* data, std::size_t size)
+{
+    std::uint32_t crc = 0xffffffff;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        crc ^= data[i];
+        for (int k = 0; k != 8; ++k)
+            crc = (crc & 1) ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+    }
+    return ~crc;
+}
+
+void test_known_values()
+{
+    HPX_TEST_EQ(hpx::util::crc32c(nullptr, 0), std::uint32_t(0));
+
+    std::string const check("123456789");
+    HPX_TEST_EQ(hpx::util::crc32c(check.data(), check.size()),
+        std::uint32_t(0xe3069283));
+
+    // RFC 3720, B.4: 32 bytes of zeros
+    std::vector<unsigned char> zeros(32, 0);
+    HPX_TEST_EQ(hpx::util::crc32c(zeros.data(), zeros.size()),
+        std::uint32_t(0x8a9136aa));
+}
+
+void test_random_data()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    // large enough to exercise all block sizes of the hardware implementation
+    std::vector<unsigned char> data(3 * 8192 * 2 + 3 * 256 + 123);
+    for (unsigned char& c : data)
+        c = static_cast<unsigned char>(dist(gen));
+
+    std::size_t const sizes[] = {0, 1, 7, 8, 9, 255, 768, 769, 3 * 8192,
+        3 * 8192 + 3 * 256 + 5, data.size() - 3};
+    for (std::size_t offset : {0, 1, 3})
+    {
+        for (std::size_t size : sizes)
+        {
+            HPX_TEST_EQ(hpx::util::crc32c(data.data() + offset, size),
+                crc32c_reference(data.data() + offset, size));
+        }
+    }
+
+    // the checksum can be computed incrementally
+    std::uint32_t crc = 0;
+    std::size_t const split = 12345;
+    crc = hpx::util::crc32c(data.data(), split, crc);
+    crc = hpx::util::crc32c(data.data() + split, data.size() - split, crc);
+    HPX_TEST_EQ(crc, crc32c_reference(data.data(), data.size()));
+}
+
+int main()
+{
+    test_known_values();
+    test_random_data();
+
+    return hpx::util::report_errors();
+}
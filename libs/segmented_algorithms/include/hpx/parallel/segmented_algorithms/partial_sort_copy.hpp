@@ -0,0 +1,248 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_PARTIAL_SORT_COPY_2020)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_PARTIAL_SORT_COPY_2020
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_partial_sort_copy
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Each partition sends its k smallest elements, these are merged
+        // into the destination range.
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename RandomIt,
+            typename Compare, typename Proj>
+        static typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        segmented_partial_sort_copy(ExPolicy const& policy, SegIter first,
+            SegIter last, RandomIt d_first, RandomIt d_last, Compare&& comp,
+            Proj&& proj, std::true_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef util::detail::algorithm_result<ExPolicy, RandomIt> result;
+
+            partial_sort_copy_candidates<value_type> algo;
+            std::size_t const k = std::distance(d_first, d_last);
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<std::vector<value_type>> candidates;
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    candidates.push_back(dispatch(traits::get_id(sit), algo,
+                        policy, std::true_type(), beg, end, k, comp, proj));
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    candidates.push_back(dispatch(traits::get_id(sit), algo,
+                        policy, std::true_type(), beg, end, k, comp, proj));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        candidates.push_back(dispatch(traits::get_id(sit),
+                            algo, policy, std::true_type(), beg, end, k, comp,
+                            proj));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    candidates.push_back(dispatch(traits::get_id(sit), algo,
+                        policy, std::true_type(), beg, end, k, comp, proj));
+                }
+            }
+
+            std::vector<value_type> smallest =
+                partial_sort_copy_merge(std::move(candidates), k,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+
+            return result::get(
+                std::move(smallest.begin(), smallest.end(), d_first));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename RandomIt,
+            typename Compare, typename Proj>
+        static typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        segmented_partial_sort_copy(ExPolicy const& policy, SegIter first,
+            SegIter last, RandomIt d_first, RandomIt d_last, Compare&& comp,
+            Proj&& proj, std::false_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef util::detail::algorithm_result<ExPolicy, RandomIt> result;
+
+            typedef std::integral_constant<bool,
+                !hpx::traits::is_forward_iterator<SegIter>::value>
+                forced_seq;
+
+            partial_sort_copy_candidates<value_type> algo;
+            std::size_t const k = std::distance(d_first, d_last);
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<future<std::vector<value_type>>> segments;
+            segments.reserve(std::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, k, comp, proj));
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, k, comp, proj));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            algo, policy, forced_seq(), beg, end, k, comp,
+                            proj));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, k, comp, proj));
+                }
+            }
+
+            util::compare_projected<Compare, Proj> comp_projected(
+                std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+            return result::get(dataflow(
+                [=](std::vector<hpx::future<std::vector<value_type>>>&& r)
+                    -> RandomIt {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+
+                    std::vector<value_type> smallest = partial_sort_copy_merge(
+                        hpx::util::unwrap(std::move(r)), k, comp_projected);
+
+                    return std::move(
+                        smallest.begin(), smallest.end(), d_first);
+                },
+                std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename RandomIt,
+            typename Compare, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        partial_sort_copy_(ExPolicy&& policy, SegIter first, SegIter last,
+            RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj,
+            std::true_type)
+        {
+            typedef parallel::execution::is_sequenced_execution_policy<ExPolicy>
+                is_seq;
+
+            if (first == last || d_first == d_last)
+            {
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    std::move(d_first));
+            }
+
+            return segmented_partial_sort_copy(std::forward<ExPolicy>(policy),
+                first, last, d_first, d_last, std::forward<Compare>(comp),
+                std::forward<Proj>(proj), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare, typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        partial_sort_copy_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj,
+            std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -0,0 +1,93 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> expected_values(std::size_t num, std::size_t k)
+{
+    // the values are num - 1, ..., 1, 0
+    std::vector<T> values(num);
+    for (std::size_t i = 0; i != num; ++i)
+        values[i] = T(num - i - 1);
+
+    std::vector<T> expected((std::min)(num, k));
+    std::partial_sort_copy(
+        values.begin(), values.end(), expected.begin(), expected.end());
+    return expected;
+}
+
+template <typename ExPolicy, typename T>
+void test_partial_sort_copy(ExPolicy&& policy,
+    hpx::partitioned_vector<T> const& xvalues, std::size_t num, std::size_t k)
+{
+    std::vector<T> result(k);
+    auto it = hpx::parallel::partial_sort_copy(
+        policy, xvalues.begin(), xvalues.end(), result.begin(), result.end());
+
+    std::vector<T> expected = expected_values<T>(num, k);
+    HPX_TEST(it == result.begin() + expected.size());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), result.begin()));
+}
+
+template <typename ExPolicy, typename T>
+void test_partial_sort_copy_async(ExPolicy&& policy,
+    hpx::partitioned_vector<T> const& xvalues, std::size_t num, std::size_t k)
+{
+    std::vector<T> result(k);
+    auto f = hpx::parallel::partial_sort_copy(
+        policy, xvalues.begin(), xvalues.end(), result.begin(), result.end());
+
+    std::vector<T> expected = expected_values<T>(num, k);
+    HPX_TEST(f.get() == result.begin() + expected.size());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), result.begin()));
+}
+
+template <typename T>
+void partial_sort_copy_tests(std::vector<hpx::id_type>& localities)
+{
+    using namespace hpx::parallel;
+
+    std::size_t const num = 10007;
+    hpx::partitioned_vector<T> xvalues(num, hpx::container_layout(localities));
+    for (std::size_t i = 0; i != num; ++i)
+        xvalues.set_value(hpx::launch::sync, i, T(num - i - 1));
+
+    for (std::size_t k : {std::size_t(1), std::size_t(100), num + 10})
+    {
+        test_partial_sort_copy(execution::seq, xvalues, num, k);
+        test_partial_sort_copy(execution::par, xvalues, num, k);
+
+        test_partial_sort_copy_async(
+            execution::seq(execution::task), xvalues, num, k);
+        test_partial_sort_copy_async(
+            execution::par(execution::task), xvalues, num, k);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    partial_sort_copy_tests<int>(localities);
+    partial_sort_copy_tests<double>(localities);
+    return hpx::util::report_errors();
+}
@@ -145,6 +145,9 @@ namespace hpx { namespace serialization {
     ///////////////////////////////////////////////////////////////////////////
     class access
     {
+    public:
+        // Detects a serialize member function, including private ones made
+        // accessible by befriending this class.
         template <class T>
         class has_serialize
         {
@@ -167,6 +170,7 @@ namespace hpx { namespace serialization {
             static constexpr bool value = decltype(test<T>(0))::value;
         };
 
+    private:
         template <class T>
         class serialize_dispatcher
         {
@@ -21,6 +21,8 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization {
@@ -58,6 +60,11 @@ namespace hpx { namespace serialization {
         void serialize_optimized(
             output_archive& ar, unsigned int, std::true_type)
         {
+            using element_type = typename std::remove_const<T>::type;
+            ar.save_layout_fingerprint<element_type>(
+                hpx::traits::needs_layout_fingerprint<element_type>());
+            ar.save_array_data_padding(alignof(element_type));
+
             // try using chunking
             ar.save_binary_chunk(m_t, m_element_count * sizeof(T));
         }
@@ -65,10 +72,58 @@ namespace hpx { namespace serialization {
         void serialize_optimized(
             input_archive& ar, unsigned int, std::true_type)
         {
+            ar.load_layout_fingerprint<T>(
+                hpx::traits::needs_layout_fingerprint<T>());
+            ar.load_array_data_padding(alignof(T));
+
             // try using chunking
             ar.load_binary_chunk(m_t, m_element_count * sizeof(T));
         }
 
+        // Try referring to the data of an array of count elements stored in
+        // the archive instead of loading it into separate memory (see
+        // input_archive::enable_zero_copy_reads). Returns nullptr without
+        // consuming any data if that is not possible, otherwise keep_alive
+        // is set to the object keeping the data alive.
+        static value_type* load_view(input_archive& ar, std::size_t count,
+            std::shared_ptr<void const>& keep_alive)
+        {
+            using use_optimized = hpx::traits::is_bitwise_serializable<T>;
+
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (!use_optimized::value || count == 0 ||
+                ar.disable_array_optimization() || archive_endianess_differs)
+            {
+                return nullptr;
+            }
+
+            using needs_fingerprint = hpx::traits::needs_layout_fingerprint<T>;
+            std::size_t offset =
+                needs_fingerprint::value ? sizeof(std::uint32_t) : 0;
+            offset += ar.array_data_padding(
+                ar.current_pos() + offset, alignof(T));
+
+            char const* data = ar.peek_binary(offset, count * sizeof(T));
+            if (data == nullptr ||
+                reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0)
+            {
+                return nullptr;
+            }
+
+            ar.load_layout_fingerprint<T>(needs_fingerprint());
+            ar.load_array_data_padding(alignof(T));
+            ar.skip_binary(count * sizeof(T));
+
+            // containers used for zero-copy reads provide writable storage
+            // (mapped_file maps files copy-on-write)
+            keep_alive = ar.keep_alive_;
+            return reinterpret_cast<value_type*>(const_cast<char*>(data));
+        }
+
         template <class Archive>
         void serialize(Archive& ar, unsigned int v)
         {
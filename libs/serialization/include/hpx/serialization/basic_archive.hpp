@@ -41,7 +41,11 @@ namespace hpx { namespace serialization {
         endian_little = 0x00008000,
         disable_array_optimization = 0x00010000,
         disable_data_chunking = 0x00020000,
-        all_archive_flags = 0x0003e000    // all of the above
+        align_array_data = 0x00040000,
+        enable_checksum = 0x00080000,
+        enable_type_ids = 0x00100000,
+        enable_receive_tags = 0x00200000,
+        all_archive_flags = 0x003fe000    // all of the above
     };
 
     void HPX_FORCEINLINE reverse_bytes(std::size_t size, char* address)
@@ -106,6 +110,41 @@ namespace hpx { namespace serialization {
                                                                           false;
         }
 
+        // bitwise serialized arrays are aligned (relative to the beginning
+        // of the archive) to the alignment of their elements, only used if
+        // data chunking is disabled
+        bool align_array_data() const
+        {
+            return (flags_ & hpx::serialization::align_array_data) ? true :
+                                                                     false;
+        }
+
+        // the archive data is followed by a CRC-32C of everything stored
+        // before it, the archive itself does not compute or verify it
+        bool enable_checksum() const
+        {
+            return (flags_ & hpx::serialization::enable_checksum) ? true :
+                                                                    false;
+        }
+
+        // polymorphic types are identified by the ids assigned to them
+        // during bootstrap instead of by their names, this is valid only for
+        // archives which are read by the same set of localities
+        bool enable_type_ids() const
+        {
+            return (flags_ & hpx::serialization::enable_type_ids) ? true :
+                                                                    false;
+        }
+
+        // serialize_buffer instances carry their receive tag (see
+        // serialize_buffer::set_receive_tag), this changes the layout of the
+        // serialized buffers and has to be enabled by both ends
+        bool enable_receive_tags() const
+        {
+            return (flags_ & hpx::serialization::enable_receive_tags) ? true :
+                                                                        false;
+        }
+
         std::uint32_t flags() const
         {
             return flags_;
@@ -154,6 +193,19 @@ namespace hpx { namespace serialization {
         }
 
     protected:
+        // number of padding bytes needed in front of array data stored at
+        // the given position of the archive
+        std::size_t array_data_padding(
+            std::size_t pos, std::size_t alignment) const
+        {
+            if (!align_array_data() || !disable_data_chunking() ||
+                alignment <= 1)
+            {
+                return 0;
+            }
+            return (alignment - pos % alignment) % alignment;
+        }
+
         std::uint32_t flags_;
         std::size_t size_;
         detail::extra_archive_data extra_data_;
@@ -31,6 +31,17 @@ namespace hpx { namespace serialization {
         virtual void reset() = 0;
         virtual std::size_t get_num_chunks() const = 0;
         virtual void flush() = 0;
+
+        // Expose a contiguous range of at least count bytes of the underlying
+        // storage starting at the current position. The number of bytes
+        // written to the range has to be committed before any other function
+        // is invoked on the container.
+        virtual bool get_write_window(
+            std::size_t /* count */, char*& /* begin */, char*& /* end */)
+        {
+            return false;
+        }
+        virtual void commit_write_window(std::size_t /* count */) {}
     };
 
     struct erased_input_container
@@ -44,6 +55,17 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Expose the contiguous range of the underlying storage which can be
+        // read starting at the current position. The number of bytes read
+        // from the range has to be committed before any other function is
+        // invoked on the container.
+        virtual bool get_read_window(
+            char const*& /* begin */, char const*& /* end */)
+        {
+            return false;
+        }
+        virtual void commit_read_window(std::size_t /* count */) {}
     };
 }}    // namespace hpx::serialization
 
@@ -13,6 +13,7 @@
 #include <hpx/serialization/access.hpp>
 #include <hpx/serialization/basic_archive.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
+#include <hpx/serialization/detail/pointer_tracker.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
@@ -23,7 +24,6 @@
 #include <hpx/type_support/lazy_conditional.hpp>
 
 #include <cstdint>
-#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -40,8 +40,10 @@ namespace hpx { namespace serialization {
         // to be copy-constructible
         using ptr_helper_ptr = std::unique_ptr<ptr_helper>;
 
-        using input_pointer_tracker = std::map<std::uint64_t, ptr_helper_ptr>;
-        using output_pointer_tracker = std::map<void const*, std::uint64_t>;
+        using input_pointer_tracker =
+            pointer_tracker<std::uint64_t, ptr_helper_ptr>;
+        using output_pointer_tracker =
+            pointer_tracker<void const*, std::uint64_t>;
 
     }    // namespace detail
 
@@ -0,0 +1,158 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_DETAIL_POINTER_TRACKER_HPP
+#define HPX_SERIALIZATION_DETAIL_POINTER_TRACKER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace serialization { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key>
+    struct pointer_tracker_key;
+
+    template <>
+    struct pointer_tracker_key<void const*>
+    {
+        static constexpr void const* empty() noexcept
+        {
+            return nullptr;
+        }
+
+        static std::uint64_t value(void const* key) noexcept
+        {
+            return static_cast<std::uint64_t>(
+                reinterpret_cast<std::uintptr_t>(key));
+        }
+    };
+
+    template <>
+    struct pointer_tracker_key<std::uint64_t>
+    {
+        static constexpr std::uint64_t empty() noexcept
+        {
+            return std::uint64_t(-1);
+        }
+
+        static constexpr std::uint64_t value(std::uint64_t key) noexcept
+        {
+            return key;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Open addressing hash table (linear probing) used to keep track of the
+    // pointers seen while (de-)serializing an object graph. Entries are never
+    // erased, the key returned by pointer_tracker_key<Key>::empty() marks
+    // unused slots and can't be inserted.
+    template <typename Key, typename Value>
+    class pointer_tracker
+    {
+        using key_traits = pointer_tracker_key<Key>;
+
+    public:
+        pointer_tracker()
+          : size_(0)
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        Value* find(Key key) noexcept
+        {
+            if (size_ == 0)
+                return nullptr;
+
+            std::size_t slot = find_slot(key);
+            if (keys_[slot] == key_traits::empty())
+                return nullptr;
+            return &values_[slot];
+        }
+
+        // Insert the given value if the key is not known yet. Returns the
+        // stored value and whether the insertion took place.
+        std::pair<Value*, bool> insert(Key key, Value&& value)
+        {
+            HPX_ASSERT(key != key_traits::empty());
+
+            // keep the load factor below 1/2
+            if (2 * (size_ + 1) > keys_.size())
+                grow();
+
+            std::size_t slot = find_slot(key);
+            if (keys_[slot] != key_traits::empty())
+                return std::make_pair(&values_[slot], false);
+
+            keys_[slot] = key;
+            values_[slot] = std::move(value);
+            ++size_;
+
+            return std::make_pair(&values_[slot], true);
+        }
+
+    private:
+        // the table size is always a power of two
+        std::size_t find_slot(Key key) const noexcept
+        {
+            std::size_t const mask = keys_.size() - 1;
+            std::size_t slot = hash(key) & mask;
+            while (keys_[slot] != key && keys_[slot] != key_traits::empty())
+            {
+                slot = (slot + 1) & mask;
+            }
+            return slot;
+        }
+
+        static std::size_t hash(Key key) noexcept
+        {
+            // mix the bits, as both pointers and archive positions tend to
+            // have their lower bits in common
+            std::uint64_t h = key_traits::value(key);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<std::size_t>(h);
+        }
+
+        void grow()
+        {
+            std::size_t capacity =
+                keys_.empty() ? std::size_t(16) : 2 * keys_.size();
+
+            std::vector<Key> keys(capacity, key_traits::empty());
+            std::vector<Value> values(capacity);
+
+            keys_.swap(keys);
+            values_.swap(values);
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                if (keys[i] != key_traits::empty())
+                {
+                    std::size_t slot = find_slot(keys[i]);
+                    keys_[slot] = keys[i];
+                    values_[slot] = std::move(values[i]);
+                }
+            }
+        }
+
+        std::vector<Key> keys_;
+        std::vector<Value> values_;
+        std::size_t size_;
+    };
+}}}    // namespace hpx::serialization::detail
+
+#endif
@@ -37,6 +37,8 @@ namespace hpx { namespace serialization { namespace detail {
         typedef std::map<std::string, ctor_t> typename_to_ctor_t;
         typedef std::map<std::string, std::uint32_t> typename_to_id_t;
         typedef std::vector<ctor_t> cache_t;
+        typedef std::map<std::string, void const*> typename_to_data_t;
+        typedef std::vector<void const*> data_cache_t;
 
         HPX_STATIC_CONSTEXPR std::uint32_t invalid_id = ~0u;
 
@@ -46,6 +48,19 @@ namespace hpx { namespace serialization { namespace detail {
         HPX_EXPORT void register_typename(
             const std::string& type_name, std::uint32_t id);
 
+        // Register a type-name which has no factory function, but should
+        // still be assigned an id (exchanged during bootstrap). The given
+        // data can be retrieved using the id once it has been assigned.
+        HPX_EXPORT void register_interned_typename(
+            const std::string& type_name, void const* data);
+
+        void const* get_interned_data(std::uint32_t id) const
+        {
+            if (id >= data_cache.size())    //-V104
+                return nullptr;
+            return data_cache[id];    //-V108
+        }
+
         HPX_EXPORT void fill_missing_typenames();
 
         HPX_EXPORT std::uint32_t try_get_id(const std::string& type_name) const;
@@ -69,11 +84,14 @@ namespace hpx { namespace serialization { namespace detail {
         friend class polymorphic_id_factory;
 
         HPX_EXPORT void cache_id(std::uint32_t id, ctor_t ctor);
+        HPX_EXPORT void cache_data(std::uint32_t id, void const* data);
 
         std::uint32_t max_id;
         typename_to_ctor_t typename_to_ctor;
         typename_to_id_t typename_to_id;
         cache_t cache;
+        typename_to_data_t typename_to_data;
+        data_cache_t data_cache;
     };
 
     class polymorphic_id_factory
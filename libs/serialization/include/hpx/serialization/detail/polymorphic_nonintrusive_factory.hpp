@@ -18,11 +18,14 @@
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/preprocessor/strip_parens.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/needs_automatic_registration.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
 #include <hpx/type_support.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -131,10 +134,30 @@ namespace hpx { namespace serialization { namespace detail {
         HPX_NON_COPYABLE(polymorphic_nonintrusive_factory);
 
     public:
+        // Information about a registered type, looked up using the name
+        // returned by its std::type_info.
+        struct class_info
+        {
+            class_info()
+              : typeinfo(nullptr)
+              , bunch(nullptr)
+              , id(id_registry::invalid_id)
+            {
+            }
+
+            std::type_info const* typeinfo;
+            std::string class_name;
+            function_bunch_type const* bunch;
+
+            // The interned id of the type. Ids are assigned by the
+            // id_registry during bootstrap, this caches the id once known.
+            mutable std::atomic<std::uint32_t> id;
+        };
+
         using serializer_map_type = std::unordered_map<std::string,
             function_bunch_type, hpx::util::jenkins_hash>;
         using serializer_typeinfo_map_type = std::unordered_map<std::string,
-            std::string, hpx::util::jenkins_hash>;
+            class_info, hpx::util::jenkins_hash>;
 
         HPX_EXPORT static polymorphic_nonintrusive_factory& instance();
 
@@ -157,9 +180,22 @@ namespace hpx { namespace serialization { namespace detail {
             auto jt = typeinfo_map_.find(typeinfo.name());
 
             if (it == map_.end())
-                map_[class_name] = bunch;
+            {
+                it = map_.emplace(class_name, bunch).first;
+
+                // have the class name take part in the id assignment, the
+                // (stable) address of the function bunch is handed back
+                // when an object is loaded using its id
+                id_registry::instance().register_interned_typename(
+                    class_name, &it->second);
+            }
             if (jt == typeinfo_map_.end())
-                typeinfo_map_[typeinfo.name()] = class_name;
+            {
+                class_info& info = typeinfo_map_[typeinfo.name()];
+                info.typeinfo = &typeinfo;
+                info.class_name = class_name;
+                info.bunch = &it->second;
+            }
         }
 
         // the following templates are defined in *.ipp file
@@ -177,6 +213,21 @@ namespace hpx { namespace serialization { namespace detail {
     private:
         polymorphic_nonintrusive_factory() {}
 
+        // Look up the information about a registered type.
+        HPX_EXPORT class_info const& get_class_info(
+            std::type_info const& typeinfo) const;
+
+        // Write the interned id of the given type (or its name, if no id
+        // has been assigned or the archive doesn't support ids) and return
+        // the functions used to serialize it.
+        HPX_EXPORT function_bunch_type const& save_class_id(
+            output_archive& ar, class_info const& info) const;
+
+        // Read the id (or name) written by save_class_id and return the
+        // functions used to deserialize the corresponding type.
+        HPX_EXPORT function_bunch_type const& load_class_id(
+            input_archive& ar) const;
+
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
         serializer_map_type map_;
@@ -15,7 +15,9 @@
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/string.hpp>
 
+#include <atomic>
 #include <string>
+#include <typeinfo>
 
 namespace hpx { namespace serialization { namespace detail {
 
@@ -23,30 +25,33 @@ namespace hpx { namespace serialization { namespace detail {
     void polymorphic_nonintrusive_factory::save(output_archive& ar, const T& t)
     {
         // It's safe to call typeid here. The typeid(t) return value is
-        // only used for local lookup to the portable string that goes over the
-        // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
-
-        map_.at(class_name).save_function(ar, &t);
+        // only used for local lookup to the portable id that goes over the
+        // wire. The information about the most recently saved dynamic type
+        // is cached for each static type, which avoids looking up the type
+        // by its name for every object.
+        static std::atomic<class_info const*> cached_info(nullptr);
+
+        std::type_info const& typeinfo = typeid(t);
+        class_info const* info = cached_info.load(std::memory_order_acquire);
+        if (info == nullptr || *info->typeinfo != typeinfo)
+        {
+            info = &get_class_info(typeinfo);
+            cached_info.store(info, std::memory_order_release);
+        }
+
+        save_class_id(ar, *info).save_function(ar, &t);
     }
 
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        map_.at(class_name).load_function(ar, &t);
+        load_class_id(ar).load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        const function_bunch_type& bunch = map_.at(class_name);
+        const function_bunch_type& bunch = load_class_id(ar);
         T* t = static_cast<T*>(bunch.create_function(ar));
 
         return t;
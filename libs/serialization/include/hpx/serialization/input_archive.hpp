@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/errors.hpp>
 #include <hpx/serialization/basic_archive.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
@@ -21,8 +22,10 @@
 #include <boost/cstdint.hpp>
 #include <boost/predef/other/endian.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -42,6 +45,10 @@ namespace hpx { namespace serialization {
           : base_type(0U)
           , buffer_(new input_container<Container>(
                 buffer, chunks, inbound_data_size))
+          , direct_reads_(false)
+          , window_begin_(nullptr)
+          , window_current_(nullptr)
+          , window_end_(nullptr)
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -119,6 +126,30 @@ namespace hpx { namespace serialization {
             return size_;
         }
 
+        // Allow data to be read directly from the storage of the underlying
+        // container (if supported by the container) instead of passing each
+        // value through the type-erased container interface. The container
+        // may not be modified while the archive is in use.
+        void enable_direct_reads()
+        {
+            direct_reads_ = true;
+        }
+
+        // Allow bitwise serialized arrays (currently the data of
+        // serialize_buffer instances) to refer to the storage of the
+        // underlying container instead of being copied out of it, this
+        // implies direct reads. The given object keeps the storage alive, it
+        // is shared by all objects referring to the storage. Data is referred
+        // to only if it is suitably aligned, see
+        // basic_archive::align_array_data.
+        void enable_zero_copy_reads(std::shared_ptr<void const> keep_alive)
+        {
+            HPX_ASSERT(keep_alive != nullptr);
+
+            direct_reads_ = true;
+            keep_alive_ = std::move(keep_alive);
+        }
+
         // this function is needed to avoid a MSVC linker error
         std::size_t current_pos() const
         {
@@ -143,16 +174,44 @@ namespace hpx { namespace serialization {
         {
             static_assert(!std::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if (disable_array_optimization())
+
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if (disable_array_optimization() || archive_endianess_differs)
             {
                 access::serialize(*this, t, 0);
             }
             else
             {
+                load_layout_fingerprint<T>(
+                    hpx::traits::needs_layout_fingerprint<T>());
                 load_binary(&t, sizeof(t));
             }
         }
 
+        template <typename T>
+        void load_layout_fingerprint(std::false_type)
+        {
+        }
+
+        template <typename T>
+        void load_layout_fingerprint(std::true_type)
+        {
+            std::uint32_t fingerprint = 0;
+            load_binary(&fingerprint, sizeof(fingerprint));
+
+            if (fingerprint != hpx::traits::layout_fingerprint<T>::value)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_archive::load_layout_fingerprint",
+                    "the memory layout of the received object does not "
+                    "match the layout of the type it is loaded into");
+            }
+        }
+
         template <class T>
         void load_nonintrusively_polymorphic(T& t, std::false_type)
         {
@@ -236,16 +295,59 @@ namespace hpx { namespace serialization {
             if (0 == count)
                 return;
 
-            buffer_->load_binary(address, count);
+            // fast path: consume from the current read window
+            if (std::size_t(window_end_ - window_current_) >= count)
+            {
+                std::memcpy(address, window_current_, count);
+                window_current_ += count;
+            }
+            else
+            {
+                load_binary_slow(address, count);
+            }
 
             size_ += count;
         }
 
+        void load_binary_slow(void* address, std::size_t count)
+        {
+            commit_read_window();
+
+            if (direct_reads_ &&
+                buffer_->get_read_window(window_begin_, window_end_))
+            {
+                window_current_ = window_begin_;
+                if (std::size_t(window_end_ - window_begin_) >= count)
+                {
+                    std::memcpy(address, window_begin_, count);
+                    window_current_ += count;
+                    return;
+                }
+
+                // let the container handle (and report) reads beyond the
+                // readable range
+                commit_read_window();
+            }
+
+            buffer_->load_binary(address, count);
+        }
+
+        void commit_read_window()
+        {
+            if (window_begin_ != nullptr)
+            {
+                buffer_->commit_read_window(window_current_ - window_begin_);
+                window_begin_ = window_current_ = window_end_ = nullptr;
+            }
+        }
+
         void load_binary_chunk(void* address, std::size_t count)
         {
             if (0 == count)
                 return;
 
+            commit_read_window();
+
             if (disable_data_chunking())
                 buffer_->load_binary(address, count);
             else
@@ -254,7 +356,65 @@ namespace hpx { namespace serialization {
             size_ += count;
         }
 
+        // skip the padding in front of array data, see
+        // basic_archive::align_array_data
+        void load_array_data_padding(std::size_t alignment)
+        {
+            char padding[64];
+
+            std::size_t count = array_data_padding(size_, alignment);
+            while (count != 0)
+            {
+                std::size_t n = (std::min)(count, sizeof(padding));
+                load_binary(padding, n);
+                count -= n;
+            }
+        }
+
+        // Return a pointer to count bytes of the container's storage
+        // starting offset bytes after the current position without
+        // consuming them, nullptr if zero-copy reads are not enabled or
+        // the data is not accessible.
+        char const* peek_binary(std::size_t offset, std::size_t count)
+        {
+            if (keep_alive_ == nullptr)
+                return nullptr;
+
+            if (std::size_t(window_end_ - window_current_) < offset + count)
+            {
+                commit_read_window();
+                if (!buffer_->get_read_window(window_begin_, window_end_))
+                    return nullptr;
+
+                window_current_ = window_begin_;
+                if (std::size_t(window_end_ - window_current_) <
+                    offset + count)
+                {
+                    return nullptr;
+                }
+            }
+            return window_current_ + offset;
+        }
+
+        // consume data previously accessed using peek_binary
+        void skip_binary(std::size_t count)
+        {
+            HPX_ASSERT(std::size_t(window_end_ - window_current_) >= count);
+
+            window_current_ += count;
+            size_ += count;
+        }
+
         std::unique_ptr<erased_input_container> buffer_;
+
+        // direct access to the storage of the container
+        bool direct_reads_;
+        char const* window_begin_;
+        char const* window_current_;
+        char const* window_end_;
+
+        // keeps the container's storage alive for zero-copy reads
+        std::shared_ptr<void const> keep_alive_;
     };
 
     //
@@ -16,6 +16,7 @@
 #include <hpx/serialization/serialization_chunk.hpp>
 #include <hpx/serialization/traits/serialization_access_data.hpp>
 
+#include <algorithm>
 #include <cstddef>    // for size_t
 #include <cstdint>
 #include <cstring>    // for memcpy
@@ -178,6 +179,76 @@ namespace hpx { namespace serialization {
             }
         }
 
+        bool get_read_window(
+            char const*& begin, char const*& end)    // override
+        {
+            return get_read_window(
+                begin, end, typename access_traits::has_contiguous_storage());
+        }
+
+        void commit_read_window(std::size_t count)    // override
+        {
+            HPX_ASSERT(current_ + count <= access_traits::size(cont_));
+            current_ += count;
+
+            if (chunks_)
+            {
+                current_chunk_size_ += count;
+
+                // make sure we switch to the next serialization_chunk if
+                // necessary
+                std::size_t current_chunk_size = get_chunk_size(current_chunk_);
+                if (current_chunk_size != 0 &&
+                    current_chunk_size_ >= current_chunk_size)
+                {
+                    HPX_ASSERT(current_chunk_size_ == current_chunk_size);
+                    ++current_chunk_;
+                    current_chunk_size_ = 0;
+                }
+            }
+        }
+
+    private:
+        bool get_read_window(char const*&, char const*&, std::false_type)
+        {
+            return false;
+        }
+
+        bool get_read_window(
+            char const*& begin, char const*& end, std::true_type)
+        {
+            if (filter_)
+                return false;
+
+            std::size_t size = access_traits::size(cont_);
+            if (chunks_)
+            {
+                // the window may not extend beyond the current
+                // serialization_chunk
+                if (current_chunk_ >= get_num_chunks() ||
+                    get_chunk_type(current_chunk_) != chunk_type_index)
+                {
+                    return false;
+                }
+
+                std::size_t current_chunk_size = get_chunk_size(current_chunk_);
+                if (current_chunk_size != 0)
+                {
+                    size = (std::min)(size,
+                        current_ + current_chunk_size - current_chunk_size_);
+                }
+            }
+
+            if (size <= current_)
+                return false;
+
+            char const* data = access_traits::data(cont_);
+            begin = data + current_;
+            end = data + size;
+            return true;
+        }
+
+    public:
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
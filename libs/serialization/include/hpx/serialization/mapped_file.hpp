@@ -0,0 +1,67 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_MAPPED_FILE_HPP
+#define HPX_SERIALIZATION_MAPPED_FILE_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace hpx { namespace serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A file mapped into memory, to be used as the container of an
+    // input_archive. The file is mapped copy-on-write: modifications of the
+    // mapped data are private to this process. Copies of a mapped_file share
+    // the mapping, which is released once the last copy and the last object
+    // referring to the mapped data are gone.
+    //
+    //      mapped_file file(path);
+    //      input_archive ar(file, file.size());
+    //      ar.enable_zero_copy_reads(file.keep_alive());
+    //
+    // The data of serialize_buffer instances loaded from such an archive
+    // refers to the mapping instead of being copied if it was saved using
+    // the align_array_data archive flag.
+    class HPX_EXPORT mapped_file
+    {
+    public:
+        mapped_file() = default;
+
+        // map the file starting at the given offset (in bytes)
+        explicit mapped_file(std::string const& path, std::size_t offset = 0);
+
+        char const* data() const noexcept;
+        std::size_t size() const noexcept;
+
+        std::size_t capacity() const noexcept
+        {
+            return size();
+        }
+
+        char const& operator[](std::size_t i) const noexcept
+        {
+            return data()[i];
+        }
+
+        // the returned object keeps the mapping alive
+        std::shared_ptr<void const> keep_alive() const noexcept
+        {
+            return mapping_;
+        }
+
+    private:
+        struct mapping;
+
+        std::shared_ptr<mapping> mapping_;
+        std::size_t offset_ = 0;
+    };
+}}    // namespace hpx::serialization
+
+#endif
@@ -23,8 +23,10 @@
 #endif
 #include <boost/predef/other/endian.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -117,6 +119,10 @@ namespace hpx { namespace serialization {
           , buffer_(detail::create_output_container(buffer, chunks, filter,
                 typename traits::serialization_access_data<
                     Container>::preprocessing_only()))
+          , direct_writes_(false)
+          , window_begin_(nullptr)
+          , window_current_(nullptr)
+          , window_end_(nullptr)
         {
             // endianness needs to be saved separately as it is needed to
             // properly interpret the flags
@@ -158,15 +164,26 @@ namespace hpx { namespace serialization {
 
         void reset()
         {
+            commit_write_window();
             buffer_->reset();
             basic_archive<output_archive>::reset();
         }
 
         void flush()
         {
+            commit_write_window();
             buffer_->flush();
         }
 
+        // Allow data to be appended directly to the storage of the underlying
+        // container (if supported by the container) instead of passing each
+        // value through the type-erased container interface. The container
+        // may hold more data than was written until the archive is flushed.
+        void enable_direct_writes()
+        {
+            direct_writes_ = true;
+        }
+
         bool is_preprocessing() const
         {
             return buffer_->is_preprocessing();
@@ -237,16 +254,37 @@ namespace hpx { namespace serialization {
         {
             static_assert(!std::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if (disable_array_optimization())
+
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if (disable_array_optimization() || archive_endianess_differs)
             {
                 access::serialize(*this, t, 0);
             }
             else
             {
+                save_layout_fingerprint<T>(
+                    hpx::traits::needs_layout_fingerprint<T>());
                 save_binary(&t, sizeof(t));
             }
         }
 
+        template <typename T>
+        void save_layout_fingerprint(std::false_type)
+        {
+        }
+
+        template <typename T>
+        void save_layout_fingerprint(std::true_type)
+        {
+            std::uint32_t fingerprint =
+                hpx::traits::layout_fingerprint<T>::value;
+            save_binary(&fingerprint, sizeof(fingerprint));
+        }
+
         template <typename T>
         void save_nonintrusively_polymorphic(T const& t, std::false_type)
         {
@@ -327,13 +365,50 @@ namespace hpx { namespace serialization {
             if (count == 0)
                 return;
             size_ += count;
+
+            // fast path: append to the current write window
+            if (std::size_t(window_end_ - window_current_) >= count)
+            {
+                std::memcpy(window_current_, address, count);
+                window_current_ += count;
+                return;
+            }
+
+            save_binary_slow(address, count);
+        }
+
+        void save_binary_slow(void const* address, std::size_t count)
+        {
+            commit_write_window();
+
+            if (direct_writes_ &&
+                buffer_->get_write_window(count, window_begin_, window_end_))
+            {
+                HPX_ASSERT(std::size_t(window_end_ - window_begin_) >= count);
+
+                std::memcpy(window_begin_, address, count);
+                window_current_ = window_begin_ + count;
+                return;
+            }
+
             buffer_->save_binary(address, count);
         }
 
+        void commit_write_window()
+        {
+            if (window_begin_ != nullptr)
+            {
+                buffer_->commit_write_window(window_current_ - window_begin_);
+                window_begin_ = window_current_ = window_end_ = nullptr;
+            }
+        }
+
         void save_binary_chunk(void const* address, std::size_t count)
         {
             if (count == 0)
                 return;
+
+            commit_write_window();
             if (disable_data_chunking())
             {
                 size_ += count;
@@ -346,7 +421,28 @@ namespace hpx { namespace serialization {
             }
         }
 
+        // write the zero bytes needed to align array data, see
+        // basic_archive::align_array_data
+        void save_array_data_padding(std::size_t alignment)
+        {
+            static char const zeros[64] = {};
+
+            std::size_t padding = array_data_padding(size_, alignment);
+            while (padding != 0)
+            {
+                std::size_t count = (std::min)(padding, sizeof(zeros));
+                save_binary(zeros, count);
+                padding -= count;
+            }
+        }
+
         std::unique_ptr<erased_output_container> buffer_;
+
+        // direct access to the storage of the container
+        bool direct_writes_;
+        char* window_begin_;
+        char* window_current_;
+        char* window_end_;
     };
 }}    // namespace hpx::serialization
 
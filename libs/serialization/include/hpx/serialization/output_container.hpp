@@ -16,6 +16,7 @@
 #include <hpx/serialization/serialization_chunk.hpp>
 #include <hpx/serialization/traits/serialization_access_data.hpp>
 
+#include <algorithm>
 #include <cstddef>    // for size_t
 #include <cstdint>
 #include <cstring>    // for memcpy
@@ -167,6 +168,7 @@ namespace hpx { namespace serialization {
           : cont_(cont)
           , current_(0)
           , chunker_(chunks)
+          , has_write_window_(false)
         {
             chunker_.reset();
         }
@@ -186,6 +188,12 @@ namespace hpx { namespace serialization {
                 chunker_.set_chunk_size(
                     current_ - chunker_.get_chunk_data_index());
             }
+
+            // release the storage handed out but not used by write windows
+            if (has_write_window_)
+            {
+                truncate(typename access_traits::has_contiguous_storage());
+            }
         }
 
         std::size_t get_num_chunks() const override
@@ -267,10 +275,75 @@ namespace hpx { namespace serialization {
             return access_traits::is_preprocessing();
         }
 
+        bool get_write_window(
+            std::size_t count, char*& begin, char*& end) override
+        {
+            return get_write_window(count, begin, end,
+                typename access_traits::has_contiguous_storage());
+        }
+
+        void commit_write_window(std::size_t count) override
+        {
+            HPX_ASSERT(current_ + count <= access_traits::size(cont_));
+            current_ += count;
+        }
+
     protected:
+        bool get_write_window(
+            std::size_t, char*&, char*&, std::false_type)
+        {
+            return false;
+        }
+
+        bool get_write_window(
+            std::size_t count, char*& begin, char*& end, std::true_type)
+        {
+            // make sure there is a current serialization_chunk descriptor
+            // available
+            if (chunker_.get_chunk_type() == chunk_type_pointer ||
+                chunker_.get_chunk_size() != 0)
+            {
+                // add a new serialization_chunk,
+                // the chunk size will be set at the end
+                chunker_.push_back(create_index_chunk(current_, 0));
+            }
+
+            // grow the container geometrically, preferably within the
+            // already allocated storage, it is truncated to its actual size
+            // while flushing
+            std::size_t size = access_traits::size(cont_);
+            std::size_t new_current = current_ + count;
+            if (size < new_current)
+            {
+                std::size_t new_size = (std::min)(
+                    access_traits::capacity(cont_),
+                    (std::max)(2 * size, std::size_t(4096)));
+
+                access_traits::resize(
+                    cont_, (std::max)(new_current, new_size) - size);
+                size = access_traits::size(cont_);
+            }
+
+            char* data = access_traits::data(cont_);
+            begin = data + current_;
+            end = data + size;
+
+            has_write_window_ = true;
+            return true;
+        }
+
+        void truncate(std::false_type) {}
+
+        void truncate(std::true_type)
+        {
+            if (access_traits::size(cont_) > current_)
+                access_traits::truncate(cont_, current_);
+        }
+
         Container& cont_;
         std::size_t current_;
         Chunker chunker_;
+        bool has_write_window_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -355,6 +428,13 @@ namespace hpx { namespace serialization {
             }
         }
 
+        bool get_write_window(std::size_t /* count */, char*& /* begin */,
+            char*& /* end */)    // override
+        {
+            // all data has to pass through the filter
+            return false;
+        }
+
     protected:
         std::size_t start_compressing_at_;
         binary_filter* filter_;
@@ -0,0 +1,47 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_RECEIVE_BUFFER_REGISTRY_HPP
+#define HPX_SERIALIZATION_RECEIVE_BUFFER_REGISTRY_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx { namespace serialization {
+
+    /// Register the memory region [data, data + size) as the destination
+    /// of all incoming serialize_buffers which were sent with the receive
+    /// tag \a tag (see serialize_buffer::set_receive_tag). The payload of such
+    /// a buffer is deserialized directly into the registered region instead of
+    /// into a freshly allocated one. The registered memory has to stay valid
+    /// until the registration is removed or \a keep_alive keeps it alive.
+    /// Registering a tag again replaces the previous registration.
+    HPX_EXPORT void register_receive_buffer(std::uint64_t tag, void* data,
+        std::size_t size, std::shared_ptr<void> keep_alive = nullptr);
+
+    /// Remove the destination registered for \a tag, returns whether such a
+    /// registration existed.
+    HPX_EXPORT bool unregister_receive_buffer(std::uint64_t tag);
+
+    namespace detail {
+
+        struct receive_buffer
+        {
+            void* data_;
+            std::size_t size_;
+            std::shared_ptr<void> keep_alive_;
+        };
+
+        // Look up the destination registered for the given tag
+        HPX_EXPORT bool find_receive_buffer(
+            std::uint64_t tag, receive_buffer& buffer);
+    }    // namespace detail
+}}       // namespace hpx::serialization
+
+#endif
@@ -13,6 +13,7 @@
 #include <hpx/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/receive_buffer_registry.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 
@@ -20,7 +21,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization {
 
@@ -268,6 +272,19 @@ namespace hpx { namespace serialization {
             return size_;
         }
 
+        // A non-zero receive tag causes the receiving end to deserialize the
+        // data of this buffer directly into the memory registered for this
+        // tag (see register_receive_buffer), if any. The tag is transmitted
+        // only by archives created with enable_receive_tags.
+        void set_receive_tag(std::uint64_t tag)
+        {
+            receive_tag_ = tag;
+        }
+        std::uint64_t receive_tag() const
+        {
+            return receive_tag_;
+        }
+
     private:
         // serialization support
         friend class hpx::serialization::access;
@@ -276,8 +293,11 @@ namespace hpx { namespace serialization {
         template <typename Archive>
         void save(Archive& ar, unsigned int const version) const
         {
-            ar << size_ << alloc_;
-            // -V128
+            ar << size_ << alloc_;    // -V128
+            if (ar.enable_receive_tags())
+            {
+                ar << receive_tag_;
+            }
 
             if (size_ != 0)
             {
@@ -289,12 +309,38 @@ namespace hpx { namespace serialization {
         template <typename Archive>
         void load(Archive& ar, unsigned int const version)
         {
-            ar >> size_ >> alloc_;
-            // -V128
+            ar >> size_ >> alloc_;    // -V128
+            receive_tag_ = 0;
+            if (ar.enable_receive_tags())
+            {
+                ar >> receive_tag_;
+            }
 
-            data_.reset(alloc_.allocate(size_), [this](T* p) {
-                serialize_buffer::deleter<allocator_type>(p, alloc_, size_);
-            });
+            detail::receive_buffer dest;
+            std::shared_ptr<void const> storage;
+            if (receive_tag_ != 0 &&
+                detail::find_receive_buffer(receive_tag_, dest) &&
+                dest.size_ >= size_ * sizeof(T))
+            {
+                // deserialize directly into the registered destination, the
+                // registration keeps the memory alive (if requested)
+                std::shared_ptr<void> keep_alive(std::move(dest.keep_alive_));
+                data_ = boost::shared_array<T>(static_cast<T*>(dest.data_),
+                    [keep_alive](T*) {});
+            }
+            else if (T* view = hpx::serialization::array<T>::load_view(
+                         ar, size_, storage))
+            {
+                // refer to the archive's storage (zero-copy reads)
+                data_ = boost::shared_array<T>(view, [storage](T*) {});
+                return;
+            }
+            else
+            {
+                data_.reset(alloc_.allocate(size_), [this](T* p) {
+                    serialize_buffer::deleter<allocator_type>(p, alloc_, size_);
+                });
+            }
 
             if (size_ != 0)
             {
@@ -315,7 +361,22 @@ namespace hpx { namespace serialization {
         boost::shared_array<T> data_;
         std::size_t size_;
         Allocator alloc_;
+        std::uint64_t receive_tag_ = 0;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Register the data of the given buffer as the destination of incoming
+    /// serialize_buffers sent with the receive tag \a tag. The registration
+    /// keeps the data of \a buffer alive.
+    template <typename T, typename Allocator>
+    void register_receive_buffer(
+        std::uint64_t tag, serialize_buffer<T, Allocator> const& buffer)
+    {
+        std::shared_ptr<void> keep_alive =
+            std::make_shared<boost::shared_array<T>>(buffer.data_array());
+        register_receive_buffer(tag, const_cast<T*>(buffer.data()),
+            buffer.size() * sizeof(T), std::move(keep_alive));
+    }
 }}    // namespace hpx::serialization
 
 namespace hpx { namespace traits {
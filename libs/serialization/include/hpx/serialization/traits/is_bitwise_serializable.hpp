@@ -8,13 +8,17 @@
 #define HPX_TRAITS_IS_BITWISE_SERIALIZABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable_aggregate.hpp>
 
 #include <type_traits>
 
 namespace hpx { namespace traits {
 
     template <typename T>
-    struct is_bitwise_serializable : std::is_arithmetic<T>
+    struct is_bitwise_serializable
+      : std::integral_constant<bool,
+            std::is_arithmetic<T>::value ||
+                is_bitwise_serializable_aggregate<T>::value>
     {
     };
 }}    // namespace hpx::traits
@@ -0,0 +1,469 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_TRAITS_IS_BITWISE_SERIALIZABLE_AGGREGATE_HPP
+#define HPX_TRAITS_IS_BITWISE_SERIALIZABLE_AGGREGATE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/config/defines.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) &&                             \
+    defined(HPX_HAVE_CXX17_IF_CONSTEXPR) &&                                    \
+    defined(HPX_HAVE_CXX17_STD_IS_AGGREGATE)
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/type_support/always_void.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#define HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES
+#endif
+
+namespace hpx { namespace traits {
+
+    template <typename T>
+    struct is_bitwise_serializable;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct is_std_array : std::false_type
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct is_std_array<std::array<T, N>> : std::true_type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // FNV-1a over the bytes of the given value
+        constexpr std::uint32_t layout_fingerprint_combine(
+            std::uint32_t seed, std::uint64_t value)
+        {
+            for (int i = 0; i != 8; ++i)
+            {
+                seed ^= static_cast<std::uint32_t>(value & 0xff);
+                seed *= 16777619u;
+                value >>= 8;
+            }
+            return seed;
+        }
+
+        constexpr std::uint32_t layout_fingerprint_basis = 2166136261u;
+    }    // namespace detail
+
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Extract the types of the members of an aggregate, the number of
+        // members is determined by the same means as for the automatic
+        // serialization of brace-initializable types.
+        template <typename T>
+        auto aggregate_members(T& t, size<1>)
+        {
+            auto& [p1] = t;
+            return util::pack<decltype(p1)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<2>)
+        {
+            auto& [p1, p2] = t;
+            return util::pack<decltype(p1), decltype(p2)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<3>)
+        {
+            auto& [p1, p2, p3] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<4>)
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<5>)
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<6>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<7>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<8>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<9>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<10>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<11>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<12>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<13>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] =
+                t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<14>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14)>{};
+        }
+
+        template <typename T>
+        auto aggregate_members(T& t, size<15>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14, p15] = t;
+            return util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14), decltype(p15)>{};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Aggregates with base classes can't be decomposed: the base
+        // subobjects are counted by arity() but are not bound by structured
+        // bindings. Base subobjects are initialized first, so an aggregate
+        // has a base class if its first element can be initialized from an
+        // object converting to base classes of T only.
+        template <typename T>
+        struct base_wildcard
+        {
+            template <typename Base,
+                typename Enable = typename std::enable_if<
+                    std::is_base_of<Base, T>::value &&
+                    !std::is_same<Base, T>::value>::type>
+            operator Base &&() const;
+
+            template <typename Base,
+                typename Enable = typename std::enable_if<
+                    std::is_base_of<Base, T>::value &&
+                    !std::is_same<Base, T>::value>::type>
+            operator Base&() const;
+        };
+
+        template <typename T>
+        constexpr auto has_aggregate_base(T*)
+            -> decltype(T{std::declval<base_wildcard<T>>()}, std::true_type{})
+        {
+            return {};
+        }
+
+        constexpr std::false_type has_aggregate_base(...)
+        {
+            return {};
+        }
+
+        template <typename T>
+        struct is_aggregate_with_base
+          : decltype(has_aggregate_base(static_cast<T*>(nullptr)))
+        {
+        };
+
+        template <typename T, typename Enable = void>
+        struct aggregate_member_types
+        {
+            using type = void;
+        };
+
+        template <typename T>
+        struct aggregate_member_types<T,
+            typename util::always_void<decltype(arity<T>())>::type>
+        {
+            using type = decltype(
+                aggregate_members(std::declval<T&>(), arity<T>()));
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A member of an aggregate can be copied bitwise if it is bitwise
+        // serializable itself (which includes nested aggregates), or if it is
+        // an enumeration or an array of such members.
+        template <typename T>
+        struct is_bitwise_serializable_member
+          : std::integral_constant<bool,
+                std::is_enum<T>::value || is_bitwise_serializable<T>::value>
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_serializable_member<T const>
+          : is_bitwise_serializable_member<T>
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_serializable_member<T&> : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_serializable_member<T&&> : std::false_type
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct is_bitwise_serializable_member<T[N]>
+          : is_bitwise_serializable_member<T>
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct is_bitwise_serializable_member<std::array<T, N>>
+          : is_bitwise_serializable_member<T>
+        {
+        };
+
+        template <typename... Ts>
+        constexpr std::size_t sum_of_sizes()
+        {
+            std::size_t const sizes[] = {0, sizeof(Ts)...};
+
+            std::size_t result = 0;
+            for (std::size_t size : sizes)
+                result += size;
+            return result;
+        }
+
+        template <typename T, typename Members>
+        struct is_bitwise_serializable_members : std::false_type
+        {
+        };
+
+        // all members have to be bitwise serializable and there may not be
+        // any padding in between or after them
+        template <typename T, typename... Ts>
+        struct is_bitwise_serializable_members<T, util::pack<Ts...>>
+          : std::integral_constant<bool,
+                util::all_of<is_bitwise_serializable_member<Ts>...>::value &&
+                    sizeof(T) == sum_of_sizes<Ts...>()>
+        {
+        };
+
+        // the conditions are checked in order of increasing cost, the members
+        // are inspected only for aggregates without user provided
+        // serialization support
+        template <typename T, typename Enable = void>
+        struct is_bitwise_serializable_aggregate_impl : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_serializable_aggregate_impl<T,
+            typename std::enable_if<std::is_class<T>::value &&
+                std::is_aggregate<T>::value &&
+                std::is_standard_layout<T>::value &&
+                std::is_trivially_copyable<T>::value &&
+                !std::is_empty<T>::value && !is_std_array<T>::value &&
+                !is_aggregate_with_base<T>::value &&
+                !hpx::serialization::access::has_serialize<T>::value &&
+                !hpx::serialization::has_serialize_adl<T>::value>::type>
+          : is_bitwise_serializable_members<T,
+                typename aggregate_member_types<T>::type>
+        {
+        };
+    }    // namespace detail
+
+    /// Simple aggregates which are trivially copyable, do not have any
+    /// padding, consist of bitwise serializable members only (arithmetic
+    /// types, enumerations, arrays, or nested aggregates satisfying the same
+    /// requirements), and which do not provide their own serialization
+    /// functions are serialized by copying their memory representation.
+    template <typename T>
+    struct is_bitwise_serializable_aggregate
+      : detail::is_bitwise_serializable_aggregate_impl<T>
+    {
+    };
+
+    namespace detail {
+
+        template <typename T>
+        constexpr std::uint32_t layout_fingerprint_of();
+
+        template <typename... Ts>
+        constexpr std::uint32_t layout_fingerprint_of_members(
+            std::uint32_t seed, util::pack<Ts...>)
+        {
+            std::uint32_t const fingerprints[] = {
+                0, layout_fingerprint_of<typename std::remove_cv<Ts>::type>()...};
+
+            for (std::uint32_t fingerprint : fingerprints)
+                seed = layout_fingerprint_combine(seed, fingerprint);
+            return seed;
+        }
+
+        // The fingerprint covers the size and alignment of the type and,
+        // recursively, the kind, size, and alignment of each of its members.
+        template <typename T>
+        constexpr std::uint32_t layout_fingerprint_of()
+        {
+            std::uint32_t seed =
+                layout_fingerprint_combine(layout_fingerprint_basis, sizeof(T));
+            seed = layout_fingerprint_combine(seed, alignof(T));
+
+            if constexpr (std::is_enum<T>::value)
+            {
+                seed = layout_fingerprint_combine(seed, 1);
+                return layout_fingerprint_combine(seed,
+                    layout_fingerprint_of<
+                        typename std::underlying_type<T>::type>());
+            }
+            else if constexpr (std::is_floating_point<T>::value)
+            {
+                return layout_fingerprint_combine(seed, 2);
+            }
+            else if constexpr (std::is_integral<T>::value)
+            {
+                return layout_fingerprint_combine(seed, 3);
+            }
+            else if constexpr (std::is_array<T>::value)
+            {
+                seed = layout_fingerprint_combine(seed, 4);
+                seed = layout_fingerprint_combine(seed, std::extent<T>::value);
+                return layout_fingerprint_combine(seed,
+                    layout_fingerprint_of<typename std::remove_cv<
+                        typename std::remove_extent<T>::type>::type>());
+            }
+            else if constexpr (is_std_array<T>::value)
+            {
+                seed = layout_fingerprint_combine(seed, 4);
+                seed = layout_fingerprint_combine(
+                    seed, std::tuple_size<T>::value);
+                return layout_fingerprint_combine(seed,
+                    layout_fingerprint_of<typename std::remove_cv<
+                        typename T::value_type>::type>());
+            }
+            else if constexpr (is_bitwise_serializable_aggregate<T>::value)
+            {
+                using members = typename aggregate_member_types<T>::type;
+
+                seed = layout_fingerprint_combine(seed, 5);
+                seed = layout_fingerprint_combine(seed, members::size);
+                return layout_fingerprint_of_members(seed, members{});
+            }
+            else
+            {
+                // other bitwise serializable types are opaque
+                return layout_fingerprint_combine(seed, 6);
+            }
+        }
+    }    // namespace detail
+
+    template <typename T>
+    struct layout_fingerprint
+      : std::integral_constant<std::uint32_t,
+            detail::layout_fingerprint_of<T>()>
+    {
+    };
+#else
+    template <typename T>
+    struct is_bitwise_serializable_aggregate : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct layout_fingerprint
+      : std::integral_constant<std::uint32_t,
+            detail::layout_fingerprint_combine(
+                detail::layout_fingerprint_combine(
+                    detail::layout_fingerprint_basis, sizeof(T)),
+                alignof(T))>
+    {
+    };
+#endif
+
+    /// The bitwise representation of automatically detected aggregates is
+    /// preceded by a fingerprint of their memory layout which is verified
+    /// while loading.
+    template <typename T>
+    struct needs_layout_fingerprint
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_FINGERPRINT)
+      : is_bitwise_serializable_aggregate<T>
+#else
+      : std::false_type
+#endif
+    {
+    };
+}}    // namespace hpx::traits
+
+#endif
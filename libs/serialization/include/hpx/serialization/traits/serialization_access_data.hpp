@@ -10,19 +10,44 @@
 #include <hpx/config.hpp>
 #include <hpx/serialization/binary_filter.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/type_support/always_void.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace traits {
 
+    namespace detail {
+
+        // containers exposing their (byte-sized) elements through a pointer
+        // to contiguous storage
+        template <typename Container, typename Enable = void>
+        struct has_contiguous_storage : std::false_type
+        {
+        };
+
+        template <typename Container>
+        struct has_contiguous_storage<Container,
+            typename util::always_void<
+                decltype(std::declval<Container&>().data()),
+                decltype(std::declval<Container&>().capacity())>::type>
+          : std::integral_constant<bool,
+                std::is_pointer<decltype(
+                    std::declval<Container&>().data())>::value &&
+                    sizeof(*std::declval<Container&>().data()) == 1>
+        {
+        };
+    }    // namespace detail
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename Container>
     struct default_serialization_access_data
     {
         using preprocessing_only = std::false_type;
+        using has_contiguous_storage = std::false_type;
 
         static constexpr bool is_preprocessing()
         {
@@ -63,6 +88,9 @@ namespace hpx { namespace traits {
     struct serialization_access_data
       : default_serialization_access_data<Container>
     {
+        using has_contiguous_storage =
+            typename detail::has_contiguous_storage<Container>::type;
+
         static std::size_t size(Container const& cont)
         {
             return cont.size();
@@ -73,6 +101,27 @@ namespace hpx { namespace traits {
             return cont.resize(cont.size() + count);
         }
 
+        // functions used for direct access to contiguous storage only
+        static std::size_t capacity(Container const& cont)
+        {
+            return cont.capacity();
+        }
+
+        static void truncate(Container& cont, std::size_t size)
+        {
+            cont.resize(size);
+        }
+
+        static char* data(Container& cont)
+        {
+            return reinterpret_cast<char*>(cont.data());
+        }
+
+        static char const* data(Container const& cont)
+        {
+            return reinterpret_cast<char const*>(cont.data());
+        }
+
         static void write(Container& cont, std::size_t count,
             std::size_t current, void const* address)
         {
@@ -10,9 +10,9 @@
 #include <hpx/serialization/detail/pointer.hpp>
 #include <hpx/serialization/input_archive.hpp>
 #include <hpx/serialization/output_archive.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <cstdint>
-#include <map>
 #include <utility>
 
 namespace hpx { namespace serialization {
@@ -21,31 +21,29 @@ namespace hpx { namespace serialization {
         input_archive& ar, std::uint64_t pos, detail::ptr_helper_ptr helper)
     {
         auto& tracker = ar.get_extra_data<detail::input_pointer_tracker>();
-        HPX_ASSERT(tracker.find(pos) == tracker.end());
 
-        tracker.insert(std::make_pair(pos, std::move(helper)));
+        auto p = tracker.insert(pos, std::move(helper));
+        HPX_ASSERT(p.second);
+        HPX_UNUSED(p);
     }
 
     detail::ptr_helper& tracked_pointer(input_archive& ar, std::uint64_t pos)
     {
         auto& tracker = ar.get_extra_data<detail::input_pointer_tracker>();
 
-        auto it = tracker.find(pos);
-        HPX_ASSERT(it != tracker.end());
+        detail::ptr_helper_ptr* helper = tracker.find(pos);
+        HPX_ASSERT(helper != nullptr);
 
-        return *it->second;
+        return **helper;
     }
 
     std::uint64_t track_pointer(output_archive& ar, void const* pos)
     {
         auto& tracker = ar.get_extra_data<detail::output_pointer_tracker>();
 
-        auto it = tracker.find(pos);
-        if (it == tracker.end())
-        {
-            tracker.insert(std::make_pair(pos, ar.bytes_written()));
+        auto p = tracker.insert(pos, ar.bytes_written());
+        if (p.second)
             return std::uint64_t(-1);
-        }
-        return it->second;
+        return *p.first;
     }
 }}    // namespace hpx::serialization
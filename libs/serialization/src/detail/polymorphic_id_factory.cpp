@@ -37,6 +37,14 @@ namespace hpx { namespace serialization { namespace detail {
         }
     }
 
+    void id_registry::cache_data(std::uint32_t id, void const* data)
+    {
+        if (id >= data_cache.size())    //-V104
+            data_cache.resize(id + 1, nullptr);    //-V106
+        if (data_cache[id] == nullptr)
+            data_cache[id] = data;    //-V108
+    }
+
     void id_registry::register_factory_function(
         const std::string& type_name, ctor_t ctor)
     {
@@ -50,6 +58,19 @@ namespace hpx { namespace serialization { namespace detail {
             cache_id(it->second, ctor);
     }
 
+    void id_registry::register_interned_typename(
+        const std::string& type_name, void const* data)
+    {
+        HPX_ASSERT(data != nullptr);
+
+        typename_to_data.emplace(type_name, data);
+
+        // populate cache
+        typename_to_id_t::const_iterator it = typename_to_id.find(type_name);
+        if (it != typename_to_id.end())
+            cache_data(it->second, data);
+    }
+
     void id_registry::register_typename(
         const std::string& type_name, std::uint32_t id)
     {
@@ -73,6 +94,11 @@ namespace hpx { namespace serialization { namespace detail {
         if (it != typename_to_ctor.end())
             cache_id(id, it->second);
 
+        typename_to_data_t::const_iterator dit =
+            typename_to_data.find(type_name);
+        if (dit != typename_to_data.end())
+            cache_data(id, dit->second);
+
         if (id > max_id)
             max_id = id;
     }
@@ -102,6 +128,14 @@ namespace hpx { namespace serialization { namespace detail {
             HPX_ASSERT(it != typename_to_id.end());
             cache_id(it->second, d.second);
         }
+
+        // Same for the interned type-names.
+        for (auto const& d : typename_to_data)
+        {
+            typename_to_id_t::const_iterator it = typename_to_id.find(d.first);
+            HPX_ASSERT(it != typename_to_id.end());
+            cache_data(it->second, d.second);
+        }
     }
 
     std::uint32_t id_registry::try_get_id(const std::string& type_name) const
@@ -124,6 +158,15 @@ namespace hpx { namespace serialization { namespace detail {
             if (!typename_to_id.count(v.first))
                 result.push_back(v.first);
 
+        // interned type-names which also have a factory function were
+        // handled above
+        for (auto const& v : typename_to_data)
+        {
+            if (!typename_to_id.count(v.first) &&
+                !typename_to_ctor.count(v.first))
+                result.push_back(v.first);
+        }
+
         return result;
     }
 
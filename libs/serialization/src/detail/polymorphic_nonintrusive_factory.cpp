@@ -7,7 +7,18 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/errors.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
 
 namespace hpx { namespace serialization { namespace detail {
     polymorphic_nonintrusive_factory&
@@ -16,4 +27,74 @@ namespace hpx { namespace serialization { namespace detail {
         hpx::util::static_<polymorphic_nonintrusive_factory> factory;
         return factory.get();
     }
+
+    polymorphic_nonintrusive_factory::class_info const&
+    polymorphic_nonintrusive_factory::get_class_info(
+        std::type_info const& typeinfo) const
+    {
+        return typeinfo_map_.at(typeinfo.name());
+    }
+
+    function_bunch_type const& polymorphic_nonintrusive_factory::save_class_id(
+        output_archive& ar, class_info const& info) const
+    {
+        // archives which may be read by other applications (e.g.
+        // checkpoints) always identify the type by its name only
+        if (!ar.enable_type_ids())
+        {
+            ar << info.class_name;
+            return *info.bunch;
+        }
+
+        // ids are assigned only once, there is no need to look them up
+        // again after they are known
+        std::uint32_t id = info.id.load(std::memory_order_relaxed);
+        if (id == id_registry::invalid_id)
+        {
+            id = id_registry::instance().try_get_id(info.class_name);
+            if (id != id_registry::invalid_id)
+                info.id.store(id, std::memory_order_relaxed);
+        }
+
+        // fall back to sending the name of the type if no id was assigned
+        // (yet), e.g. for archives created before bootstrap has finished
+        ar << id;
+        if (id == id_registry::invalid_id)
+            ar << info.class_name;
+
+        return *info.bunch;
+    }
+
+    function_bunch_type const& polymorphic_nonintrusive_factory::load_class_id(
+        input_archive& ar) const
+    {
+        // the type id prefix is written only by archives using type ids
+        if (!ar.enable_type_ids())
+        {
+            std::string class_name;
+            ar >> class_name;
+
+            return map_.at(class_name);
+        }
+
+        std::uint32_t id = id_registry::invalid_id;
+        ar >> id;
+
+        if (id == id_registry::invalid_id)
+        {
+            std::string class_name;
+            ar >> class_name;
+
+            return map_.at(class_name);
+        }
+
+        void const* bunch = id_registry::instance().get_interned_data(id);
+        if (bunch == nullptr)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "polymorphic_nonintrusive_factory::load_class_id",
+                "Unknown type id " + std::to_string(id));
+        }
+        return *static_cast<function_bunch_type const*>(bunch);
+    }
 }}}    // namespace hpx::serialization::detail
@@ -0,0 +1,155 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/serialization/mapped_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct mapped_file::mapping
+    {
+        explicit mapping(std::string const& path);
+
+        mapping(mapping const&) = delete;
+        mapping& operator=(mapping const&) = delete;
+
+        ~mapping()
+        {
+            if (data_ == nullptr)
+                return;
+#if defined(HPX_WINDOWS)
+            ::UnmapViewOfFile(data_);
+#else
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    mapped_file::mapping::mapping(std::string const& path)
+    {
+#if defined(HPX_WINDOWS)
+        HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not open file: " + path);
+        }
+
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size))
+        {
+            ::CloseHandle(file);
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not determine the size of file: " + path);
+        }
+
+        if (size.QuadPart == 0)
+        {
+            ::CloseHandle(file);
+            return;
+        }
+
+        HANDLE file_mapping = ::CreateFileMappingA(
+            file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        if (file_mapping == nullptr)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not map file: " + path);
+        }
+
+        void* data = ::MapViewOfFile(file_mapping, FILE_MAP_COPY, 0, 0, 0);
+        ::CloseHandle(file_mapping);
+        if (data == nullptr)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not map file: " + path);
+        }
+
+        data_ = static_cast<char const*>(data);
+        size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not open file: " + path);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not determine the size of file: " + path);
+        }
+
+        std::size_t size = static_cast<std::size_t>(st.st_size);
+        if (size == 0)
+        {
+            ::close(fd);
+            return;
+        }
+
+        // map the file copy-on-write, this allows for the mapped data to
+        // be handed out as modifiable memory
+        void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error, "mapped_file::mapped_file",
+                "could not map file: " + path);
+        }
+
+        data_ = static_cast<char const*>(data);
+        size_ = size;
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_file::mapped_file(std::string const& path, std::size_t offset)
+      : mapping_(std::make_shared<mapping>(path))
+      , offset_(offset)
+    {
+        if (offset_ > mapping_->size_)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "mapped_file::mapped_file",
+                "the offset is beyond the end of file: " + path);
+        }
+    }
+
+    char const* mapped_file::data() const noexcept
+    {
+        return mapping_ ? mapping_->data_ + offset_ : nullptr;
+    }
+
+    std::size_t mapped_file::size() const noexcept
+    {
+        return mapping_ ? mapping_->size_ - offset_ : 0;
+    }
+}}    // namespace hpx::serialization
@@ -0,0 +1,82 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/serialization/receive_buffer_registry.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace hpx { namespace serialization {
+
+    namespace detail {
+
+        struct receive_buffer_registry
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+            using map_type =
+                std::unordered_map<std::uint64_t, receive_buffer>;
+
+            static receive_buffer_registry& instance()
+            {
+                static receive_buffer_registry registry;
+                return registry;
+            }
+
+            mutex_type mtx_;
+            map_type buffers_;
+        };
+
+        bool find_receive_buffer(std::uint64_t tag, receive_buffer& buffer)
+        {
+            receive_buffer_registry& registry =
+                receive_buffer_registry::instance();
+
+            std::lock_guard<receive_buffer_registry::mutex_type> l(
+                registry.mtx_);
+
+            auto it = registry.buffers_.find(tag);
+            if (it == registry.buffers_.end())
+                return false;
+
+            buffer = it->second;
+            return true;
+        }
+    }    // namespace detail
+
+    void register_receive_buffer(std::uint64_t tag, void* data,
+        std::size_t size, std::shared_ptr<void> keep_alive)
+    {
+        HPX_ASSERT(tag != 0);
+        HPX_ASSERT(data != nullptr || size == 0);
+
+        detail::receive_buffer_registry& registry =
+            detail::receive_buffer_registry::instance();
+
+        std::lock_guard<detail::receive_buffer_registry::mutex_type> l(
+            registry.mtx_);
+
+        registry.buffers_[tag] =
+            detail::receive_buffer{data, size, std::move(keep_alive)};
+    }
+
+    bool unregister_receive_buffer(std::uint64_t tag)
+    {
+        detail::receive_buffer_registry& registry =
+            detail::receive_buffer_registry::instance();
+
+        std::lock_guard<detail::receive_buffer_registry::mutex_type> l(
+            registry.mtx_);
+
+        return registry.buffers_.erase(tag) != 0;
+    }
+}}    // namespace hpx::serialization
@@ -6,6 +6,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/input_archive.hpp>
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialize.hpp>
@@ -197,10 +198,53 @@ void test_member()
     }
 }
 
+void test_interned_ids()
+{
+    std::vector<char> buffer_by_name;
+    {
+        hpx::serialization::output_archive oarchive(buffer_by_name);
+        oarchive << A(42);
+    }
+
+    // assign ids to all registered types, this is normally done while
+    // bootstrapping the runtime
+    hpx::serialization::detail::id_registry::instance()
+        .fill_missing_typenames();
+
+    std::vector<char> buffer_by_id;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer_by_id, hpx::serialization::enable_type_ids);
+        oarchive << A(42);
+    }
+
+    // the type is now identified by its id instead of its name
+    HPX_TEST_LT(buffer_by_id.size(), buffer_by_name.size());
+
+    // archives which don't enable ids keep using the name
+    std::vector<char> buffer_default;
+    {
+        hpx::serialization::output_archive oarchive(buffer_default);
+        oarchive << A(42);
+    }
+    HPX_TEST(buffer_default == buffer_by_name);
+
+    // archives using either representation can be loaded
+    for (std::vector<char> const* buffer : {&buffer_by_name, &buffer_by_id})
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        A a;
+        iarchive >> a;
+        HPX_TEST_EQ(a.a, 42);
+    }
+}
+
 int main()
 {
     test_basic();
     test_member();
 
+    test_interned_ids();
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,307 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization.hpp>
+
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+#include <hpx/errors.hpp>
+#include <hpx/testing.hpp>
+
+#include <boost/predef/other/endian.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct point
+{
+    double x;
+    double y;
+    double z;
+};
+
+bool operator==(point const& lhs, point const& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+}
+
+enum class kind : std::int32_t
+{
+    electron,
+    proton
+};
+
+struct particle
+{
+    point position;
+    kind type;
+    std::uint32_t id;
+    std::array<float, 4> color;
+};
+
+bool operator==(particle const& lhs, particle const& rhs)
+{
+    return lhs.position == rhs.position && lhs.type == rhs.type &&
+        lhs.id == rhs.id && lhs.color == rhs.color;
+}
+
+static_assert(hpx::traits::is_bitwise_serializable<point>::value,
+    "hpx::traits::is_bitwise_serializable<point>::value");
+static_assert(hpx::traits::is_bitwise_serializable<particle>::value,
+    "hpx::traits::is_bitwise_serializable<particle>::value");
+static_assert(
+    hpx::traits::is_bitwise_serializable<std::pair<point, particle>>::value,
+    "hpx::traits::is_bitwise_serializable<std::pair<point, particle>>::value");
+
+///////////////////////////////////////////////////////////////////////////////
+// types which have to be serialized member-wise
+struct padded
+{
+    char c;
+    double d;
+};
+
+bool operator==(padded const& lhs, padded const& rhs)
+{
+    return lhs.c == rhs.c && lhs.d == rhs.d;
+}
+
+struct with_pointer
+{
+    std::int64_t* p;
+};
+
+struct with_string
+{
+    std::string str;
+    int i;
+};
+
+struct with_serialize
+{
+    std::int32_t i;
+    std::int32_t j;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & i;
+    }
+};
+
+// a private serialize function is found through the access class
+class with_private_serialize
+{
+public:
+    std::int32_t i;
+    std::int32_t j;
+
+private:
+    friend class hpx::serialization::access;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & i;
+    }
+};
+
+// aggregates with base classes can't be decomposed into their members
+struct empty_base
+{
+};
+
+struct with_empty_base : empty_base
+{
+    std::int32_t i;
+    std::int32_t j;
+};
+
+struct base_pair
+{
+    std::int32_t i;
+    std::int32_t j;
+};
+
+struct with_base : base_pair
+{
+};
+
+static_assert(!hpx::traits::is_bitwise_serializable<padded>::value,
+    "!hpx::traits::is_bitwise_serializable<padded>::value");
+static_assert(!hpx::traits::is_bitwise_serializable<with_pointer>::value,
+    "!hpx::traits::is_bitwise_serializable<with_pointer>::value");
+static_assert(!hpx::traits::is_bitwise_serializable<with_string>::value,
+    "!hpx::traits::is_bitwise_serializable<with_string>::value");
+static_assert(!hpx::traits::is_bitwise_serializable<with_serialize>::value,
+    "!hpx::traits::is_bitwise_serializable<with_serialize>::value");
+static_assert(
+    !hpx::traits::is_bitwise_serializable<with_private_serialize>::value,
+    "!hpx::traits::is_bitwise_serializable<with_private_serialize>::value");
+static_assert(!hpx::traits::is_bitwise_serializable<with_empty_base>::value,
+    "!hpx::traits::is_bitwise_serializable<with_empty_base>::value");
+static_assert(!hpx::traits::is_bitwise_serializable<with_base>::value,
+    "!hpx::traits::is_bitwise_serializable<with_base>::value");
+
+///////////////////////////////////////////////////////////////////////////////
+// types of the same size with different layouts
+struct two_halves
+{
+    std::int32_t first;
+    std::int32_t second;
+};
+
+struct one_whole
+{
+    std::int64_t value;
+};
+
+static_assert(hpx::traits::layout_fingerprint<two_halves>::value !=
+        hpx::traits::layout_fingerprint<one_whole>::value,
+    "layout_fingerprint<two_halves> != layout_fingerprint<one_whole>");
+
+///////////////////////////////////////////////////////////////////////////////
+particle make_particle(std::uint32_t id)
+{
+    return particle{{1.0 * id, 2.0 * id, 3.0 * id}, kind::proton, id,
+        {{0.1f, 0.2f, 0.3f, 1.0f}}};
+}
+
+void test_aggregates()
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    particle p = make_particle(42);
+    padded pd{'x', 3.1415};
+    std::pair<point, particle> pr{{4.0, 5.0, 6.0}, make_particle(7)};
+    with_serialize ws{1, 2};
+    with_private_serialize wps{3, 4};
+
+    oarchive << p << pd << pr << ws << wps;
+
+    hpx::serialization::input_archive iarchive(buffer);
+
+    particle p1;
+    padded pd1;
+    std::pair<point, particle> pr1;
+    with_serialize ws1{0, 0};
+    with_private_serialize wps1{0, 0};
+
+    iarchive >> p1 >> pd1 >> pr1 >> ws1 >> wps1;
+
+    HPX_TEST(p == p1);
+    HPX_TEST(pd == pd1);
+    HPX_TEST(pr.first == pr1.first);
+    HPX_TEST(pr.second == pr1.second);
+    HPX_TEST_EQ(ws1.i, ws.i);
+    HPX_TEST_EQ(ws1.j, 0);
+    HPX_TEST_EQ(wps1.i, wps.i);
+    HPX_TEST_EQ(wps1.j, 0);
+}
+
+// archives using the other byte order serialize aggregates member-wise
+void test_foreign_endianness()
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    std::uint32_t const flags = hpx::serialization::endian_little;
+#else
+    std::uint32_t const flags = hpx::serialization::endian_big;
+#endif
+
+    two_halves th{0x01020304, 0x05060708};
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << th;
+    }
+
+    std::vector<char> expected;
+    {
+        hpx::serialization::output_archive oarchive(expected, flags);
+        oarchive << th.first << th.second;
+    }
+
+    HPX_TEST(buffer == expected);
+
+    hpx::serialization::input_archive iarchive(buffer);
+
+    two_halves th1{0, 0};
+    iarchive >> th1;
+
+    HPX_TEST_EQ(th1.first, th.first);
+    HPX_TEST_EQ(th1.second, th.second);
+}
+
+void test_containers_of_aggregates()
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    std::vector<particle> v;
+    for (std::uint32_t i = 0; i != 100; ++i)
+        v.push_back(make_particle(i));
+
+    std::array<point, 3> a = {{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+
+    oarchive << v << a;
+
+    hpx::serialization::input_archive iarchive(buffer);
+
+    std::vector<particle> v1;
+    std::array<point, 3> a1;
+
+    iarchive >> v1 >> a1;
+
+    HPX_TEST(v == v1);
+    HPX_TEST(a == a1);
+}
+
+void test_layout_mismatch()
+{
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_FINGERPRINT)
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    oarchive << two_halves{1, 2};
+
+    hpx::serialization::input_archive iarchive(buffer);
+
+    bool caught_exception = false;
+    try
+    {
+        one_whole w;
+        iarchive >> w;
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+#endif
+}
+
+int main()
+{
+    test_aggregates();
+    test_foreign_endianness();
+    test_containers_of_aggregates();
+    test_layout_mismatch();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
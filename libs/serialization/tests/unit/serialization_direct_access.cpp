@@ -0,0 +1,126 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct small
+{
+    std::int32_t i;
+    double d;
+    char c;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & i & d & c;
+        // clang-format on
+    }
+};
+
+std::vector<small> make_data(std::size_t size)
+{
+    std::vector<small> data;
+    data.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data.push_back(small{std::int32_t(i), 0.5 * i, char('a' + i % 26)});
+    }
+    return data;
+}
+
+void check_data(std::vector<small> const& lhs, std::vector<small> const& rhs)
+{
+    HPX_TEST_EQ(lhs.size(), rhs.size());
+    for (std::size_t i = 0; i != lhs.size() && i != rhs.size(); ++i)
+    {
+        HPX_TEST_EQ(lhs[i].i, rhs[i].i);
+        HPX_TEST_EQ(lhs[i].d, rhs[i].d);
+        HPX_TEST_EQ(lhs[i].c, rhs[i].c);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_direct_access(std::size_t reserve, bool direct_writes,
+    bool direct_reads, bool use_chunks)
+{
+    std::vector<small> data = make_data(1000);
+    std::string str(1000, 'x');
+
+    // large enough to be sent as a separate (zero-copy) chunk
+    std::vector<double> large(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD, 42.0);
+
+    std::vector<char> buffer;
+    buffer.reserve(reserve);
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t bytes_written = 0;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, 0U, use_chunks ? &chunks : nullptr);
+        if (direct_writes)
+            oarchive.enable_direct_writes();
+
+        oarchive << data << large << str << data;
+        oarchive.flush();
+
+        bytes_written = oarchive.bytes_written();
+    }
+
+    // the buffer has been truncated to the data actually written
+    HPX_TEST_EQ(buffer.size(), bytes_written);
+
+    // zero-copy chunks are not stored in the buffer
+    std::size_t bytes_to_read = bytes_written;
+    if (use_chunks)
+        bytes_to_read += large.size() * sizeof(double);
+
+    std::vector<small> data1, data2;
+    std::vector<double> large1;
+    std::string str1;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, buffer.size(), use_chunks ? &chunks : nullptr);
+        if (direct_reads)
+            iarchive.enable_direct_reads();
+
+        iarchive >> data1 >> large1 >> str1 >> data2;
+
+        HPX_TEST_EQ(iarchive.bytes_read(), bytes_to_read);
+    }
+
+    check_data(data, data1);
+    check_data(data, data2);
+    HPX_TEST(large == large1);
+    HPX_TEST_EQ(str, str1);
+}
+
+int main()
+{
+    for (std::size_t reserve : {std::size_t(0), std::size_t(1024 * 1024)})
+    {
+        for (bool use_chunks : {false, true})
+        {
+            test_direct_access(reserve, false, false, use_chunks);
+            test_direct_access(reserve, true, false, use_chunks);
+            test_direct_access(reserve, false, true, use_chunks);
+            test_direct_access(reserve, true, true, use_chunks);
+        }
+    }
+
+    return hpx::util::report_errors();
+}
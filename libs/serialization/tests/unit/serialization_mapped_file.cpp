@@ -0,0 +1,155 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/errors.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/mapped_file.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+char const* const filename = "serialization_mapped_file.dat";
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+bool refers_to(buffer_type const& buffer,
+    hpx::serialization::mapped_file const& file)
+{
+    char const* data = reinterpret_cast<char const*>(buffer.data());
+    return data >= file.data() && data < file.data() + file.size();
+}
+
+void write_file(std::size_t prefix, std::uint32_t flags)
+{
+    std::vector<double> data(1000);
+    for (std::size_t i = 0; i != data.size(); ++i)
+        data[i] = 0.5 * i;
+
+    // misalign the data following the string
+    std::string str("odd");
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << str
+                 << buffer_type(data.data(), data.size(), buffer_type::copy)
+                 << data << str
+                 << buffer_type(data.data(), data.size(), buffer_type::copy);
+    }
+
+    std::ofstream out(filename, std::ios::binary);
+    out << std::string(prefix, 'x');
+    out.write(buffer.data(), buffer.size());
+}
+
+void check_data(buffer_type const& buffer)
+{
+    HPX_TEST_EQ(buffer.size(), std::size_t(1000));
+    for (std::size_t i = 0; i != buffer.size(); ++i)
+    {
+        HPX_TEST_EQ(buffer[i], 0.5 * i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mapped_file(std::size_t prefix, bool align, bool zero_copy)
+{
+    write_file(prefix,
+        align ? hpx::serialization::align_array_data :
+                hpx::serialization::no_archive_flags);
+
+    buffer_type buffer1, buffer2;
+    std::vector<double> data;
+    std::string str1, str2;
+    {
+        hpx::serialization::mapped_file file(filename, prefix);
+
+        hpx::serialization::input_archive iarchive(file, file.size());
+        if (zero_copy)
+            iarchive.enable_zero_copy_reads(file.keep_alive());
+
+        iarchive >> str1 >> buffer1 >> data >> str2 >> buffer2;
+
+        HPX_TEST_EQ(iarchive.bytes_read(), file.size());
+
+        // aligned data is not copied out of the mapping
+        if (align && zero_copy)
+        {
+            HPX_TEST(refers_to(buffer1, file));
+            HPX_TEST(refers_to(buffer2, file));
+        }
+        else if (!zero_copy)
+        {
+            HPX_TEST(!refers_to(buffer1, file));
+            HPX_TEST(!refers_to(buffer2, file));
+        }
+    }
+
+    // the buffers keep the mapping alive
+    check_data(buffer1);
+    check_data(buffer2);
+    HPX_TEST_EQ(str1, std::string("odd"));
+    HPX_TEST_EQ(str2, std::string("odd"));
+
+    HPX_TEST_EQ(data.size(), std::size_t(1000));
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        HPX_TEST_EQ(data[i], 0.5 * i);
+    }
+
+    // the mapping is private, modifications do not change the file
+    buffer1[0] = 42.0;
+
+    hpx::serialization::mapped_file file(filename, prefix);
+    hpx::serialization::input_archive iarchive(file, file.size());
+    iarchive.enable_zero_copy_reads(file.keep_alive());
+
+    buffer_type buffer3;
+    iarchive >> str1 >> buffer3;
+    check_data(buffer3);
+}
+
+void test_missing_file()
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::serialization::mapped_file file("this file does not exist");
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    for (std::size_t prefix : {std::size_t(0), sizeof(std::int64_t)})
+    {
+        test_mapped_file(prefix, false, false);
+        test_mapped_file(prefix, false, true);
+        test_mapped_file(prefix, true, false);
+        test_mapped_file(prefix, true, true);
+    }
+    test_missing_file();
+
+    std::remove(filename);
+
+    return hpx::util::report_errors();
+}
@@ -9,11 +9,16 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/actions.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialize_buffer.hpp>
 #include <hpx/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -131,6 +136,75 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+void test_registered_receive_buffer(std::size_t size)
+{
+    using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+    buffer_type send_buffer(size);
+    std::iota(send_buffer.begin(), send_buffer.end(), 0.0);
+    send_buffer.set_receive_tag(42);
+
+    std::vector<char> archive_data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(archive_data,
+            hpx::serialization::enable_receive_tags, &chunks);
+        oarchive << send_buffer;
+    }
+
+    // no destination registered, the buffer allocates its own memory
+    {
+        buffer_type recv_buffer;
+        hpx::serialization::input_archive iarchive(
+            archive_data, archive_data.size(), &chunks);
+        iarchive >> recv_buffer;
+
+        HPX_TEST_EQ(recv_buffer.size(), size);
+        HPX_TEST_EQ(recv_buffer.receive_tag(), std::uint64_t(42));
+        HPX_TEST(std::equal(
+            send_buffer.begin(), send_buffer.end(), recv_buffer.begin()));
+    }
+
+    // the data lands directly in the registered destination
+    buffer_type destination(size);
+    hpx::serialization::register_receive_buffer(42, destination);
+    {
+        buffer_type recv_buffer;
+        hpx::serialization::input_archive iarchive(
+            archive_data, archive_data.size(), &chunks);
+        iarchive >> recv_buffer;
+
+        HPX_TEST_EQ(recv_buffer.size(), size);
+        HPX_TEST_EQ(recv_buffer.data(), destination.data());
+        HPX_TEST(std::equal(
+            send_buffer.begin(), send_buffer.end(), destination.begin()));
+    }
+
+    // without enable_receive_tags the tag is not transmitted
+    {
+        std::vector<char> untagged_data;
+        std::vector<hpx::serialization::serialization_chunk> untagged_chunks;
+        {
+            hpx::serialization::output_archive oarchive(
+                untagged_data, 0, &untagged_chunks);
+            oarchive << send_buffer;
+        }
+
+        buffer_type recv_buffer;
+        hpx::serialization::input_archive iarchive(
+            untagged_data, untagged_data.size(), &untagged_chunks);
+        iarchive >> recv_buffer;
+
+        HPX_TEST_EQ(recv_buffer.receive_tag(), std::uint64_t(0));
+        HPX_TEST_NEQ(recv_buffer.data(), destination.data());
+        HPX_TEST(std::equal(
+            send_buffer.begin(), send_buffer.end(), recv_buffer.begin()));
+    }
+
+    HPX_TEST(hpx::serialization::unregister_receive_buffer(42));
+    HPX_TEST(!hpx::serialization::unregister_receive_buffer(42));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -156,6 +230,11 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
     }
 
+    for (std::size_t size = 1; size <= max_size; size *= 2)
+    {
+        test_registered_receive_buffer(size);
+    }
+
     return hpx::finalize();
 }
 
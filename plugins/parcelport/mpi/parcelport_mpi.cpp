@@ -118,6 +118,13 @@ namespace hpx { namespace parcelset
                 threads::policies::callback_notifier const& notifier)
               : base_type(ini, here(), notifier)
               , stopped_(false)
+              , sender_(std::make_shared<sender::buffer_pool_type>(
+                    hpx::util::get_entry_as<std::size_t>(ini,
+                        "hpx.parcel.buffer_pool_max_cached",
+                        sender::buffer_pool_type::default_max_cached),
+                    hpx::util::get_entry_as<std::size_t>(ini,
+                        "hpx.parcel.buffer_pool_max_buffer_size",
+                        sender::buffer_pool_type::default_max_buffer_size)))
               , receiver_(*this)
             {}
 
@@ -184,6 +191,12 @@ namespace hpx { namespace parcelset
                 return parcelset::locality(locality());
             }
 
+            std::int64_t get_buffer_pool_statistics(
+                buffer_pool_statistics_type t, bool reset) override
+            {
+                return sender_.buffer_pool().get_statistics(t, reset);
+            }
+
             bool background_work(
                 std::size_t num_thread, parcelport_background_mode mode)
             {
@@ -66,6 +66,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::runtime_configuration const& ini,
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
+      , buffer_pool_(std::make_shared<buffer_pool_type>(
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.buffer_pool_max_cached",
+                buffer_pool_type::default_max_cached),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.buffer_pool_max_buffer_size",
+                buffer_pool_type::default_max_buffer_size)))
+      , stripe_connections_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel.tcp.stripe_connections", 1))
+      , stripe_threshold_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel.tcp.stripe_threshold", 1048576))
       , acceptor_(nullptr)
     {
         if (here_.type() != std::string("tcp")) {
@@ -97,7 +108,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, stripes_));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -139,6 +151,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             write_connections_.clear();
 #endif
         }
+
+        // fail the striped messages which are still being received
+        stripes_.abort();
         if(acceptor_ != nullptr)
         {
             boost::system::error_code ec;
@@ -155,7 +170,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(new sender(io_service, l,
+            this, buffer_pool_, stripe_connections_, stripe_threshold_));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -289,7 +305,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             boost::asio::io_service& io_service = io_service_pool_.get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, stripes_));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this,
@@ -22,6 +22,8 @@ namespace hpx { namespace traits
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      stripe_connections = 1
+    //      stripe_threshold = 1048576
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -36,7 +38,12 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return
+                "stripe_connections = "
+                    "${HPX_PARCEL_TCP_STRIPE_CONNECTIONS:1}\n"
+                "stripe_threshold = "
+                    "${HPX_PARCEL_TCP_STRIPE_THRESHOLD:1048576}\n"
+                ;
         }
     };
 }}
@@ -52,6 +52,7 @@
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/yield_while.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -66,82 +67,24 @@
 
 namespace hpx { namespace agas
 {
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        typedef std::pair<naming::gid_type, naming::gid_type> key_type;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-                naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    }; // }}}
 
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
+  : gva_cache_(new gva_cache_type(ini_.get_agas_local_cache_size(),
+        ini_.get_os_thread_count(), ini_.get_agas_range_caching_mode()))
+  , symbol_cache_epoch_(0)
   , console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
-  , refcnt_requests_(new refcnt_requests_type)
+  , refcnt_flush_interval_(ini_.get_agas_refcnt_flush_interval())
+  , refcnt_flush_started_(false)
+  , refcnt_flush_timer_(
+        [this]() -> bool { return flush_refcnt_requests(); },
+        refcnt_flush_interval_ * 1000,
+        "addressing_service::flush_refcnt_requests", true)
   , service_type(ini_.get_agas_service_mode())
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
@@ -152,8 +95,6 @@ addressing_service::addressing_service(
   , state_(state_starting)
   , locality_()
 {
-    if (caching_)
-        gva_cache_->reserve(ini_.get_agas_local_cache_size());
 }
 
 #if defined(HPX_HAVE_NETWORKING)
@@ -962,15 +903,11 @@ bool addressing_service::is_local_address_cached(
     naming::gid_type id(naming::detail::get_stripped_gid_except_dont_cache(gid));
 
 #if defined(HPX_HAVE_NETWORKING)
-    if (naming::detail::is_migratable(gid))
+    if (naming::detail::is_migratable(gid) && was_object_migrated_hint(id))
     {
-        std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
-        if (was_object_migrated_locked(id))
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
-            return false;
-        }
+        if (&ec != &throws)
+            ec = make_success_code();
+        return false;
     }
 #endif
 
@@ -1224,15 +1161,11 @@ bool addressing_service::resolve_cached(
     }
 
     // force routing if target object was migrated
-    if (naming::detail::is_migratable(id))
+    if (naming::detail::is_migratable(id) && was_object_migrated_hint(id))
     {
-        std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
-        if (was_object_migrated_locked(id))
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
-            return false;
-        }
+        if (&ec != &throws)
+            ec = make_success_code();
+        return false;
     }
 
     // first look up the requested item in the cache
@@ -1589,12 +1522,13 @@ lcos::future<std::int64_t> addressing_service::incref_async(
     std::int64_t pending_decrefs = 0;
 
     {
-        std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+        refcnt_requests_shard& shard = get_refcnt_shard(raw);
+        std::lock_guard<mutex_type> l(shard.mtx_);
 
         typedef refcnt_requests_type::iterator iterator;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        iterator matches = shard.requests_.find(raw);
+        if (matches != shard.requests_.end())
         {
             pending_decrefs = matches->second;
             matches->second += credit;
@@ -1611,13 +1545,13 @@ lcos::future<std::int64_t> addressing_service::incref_async(
                 pending_incref = mapping(matches->first, matches->second);
                 has_pending_incref = true;
 
-                refcnt_requests_->erase(matches);
+                shard.requests_.erase(matches);
             }
             else if (matches->second == 0)
             {
                 // credit == decref (case no. 3): if the incref offsets any
                 // pending decref, just remove the pending decref request.
-                refcnt_requests_->erase(matches);
+                shard.requests_.erase(matches);
             }
             else
             {
@@ -1686,35 +1620,50 @@ void addressing_service::decref(
     }
 
     try {
-        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-
-        // Match the decref request with entries in the incref table
-        typedef refcnt_requests_type::iterator iterator;
-        typedef refcnt_requests_type::value_type mapping;
-
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
-        {
-            matches->second -= credit;
-        }
-        else
         {
-            std::pair<iterator, bool> p =
-                refcnt_requests_->insert(mapping(raw, -credit));
+            refcnt_requests_shard& shard = get_refcnt_shard(raw);
+            std::unique_lock<mutex_type> l(shard.mtx_);
 
-            if (HPX_UNLIKELY(!p.second))
+            // Match the decref request with entries in the incref table
+            typedef refcnt_requests_type::iterator iterator;
+            typedef refcnt_requests_type::value_type mapping;
+
+            iterator matches = shard.requests_.find(raw);
+            if (matches != shard.requests_.end())
             {
-                l.unlock();
+                matches->second -= credit;
+            }
+            else
+            {
+                std::pair<iterator, bool> p =
+                    shard.requests_.insert(mapping(raw, -credit));
+
+                if (HPX_UNLIKELY(!p.second))
+                {
+                    l.unlock();
 
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "addressing_service::decref"
-                  , hpx::util::format("couldn't insert decref request "
-                        "for {1} ({2})", raw, credit));
-                return;
+                    HPX_THROWS_IF(ec, bad_parameter
+                      , "addressing_service::decref"
+                      , hpx::util::format("couldn't insert decref request "
+                            "for {1} ({2})", raw, credit));
+                    return;
+                }
             }
         }
 
-        send_refcnt_requests(l, ec);
+        // send the pending requests if the cache is full (or disabled)
+        if (!enable_refcnt_caching_ ||
+            max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
+            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        start_refcnt_flush_timer();
+
+        if (&ec != &throws)
+            ec = make_success_code();
     }
     catch (hpx::exception const& e) {
         HPX_RETHROWS_IF(ec, e, "addressing_service::decref");
@@ -1872,6 +1821,135 @@ future<hpx::id_type> addressing_service::on_symbol_namespace_event(
         )));
 }
 
+std::vector<future<hpx::id_type> >
+addressing_service::on_symbol_namespace_events(
+    std::vector<std::string> const& names)
+{
+    std::vector<future<hpx::id_type> > results(names.size());
+
+    // look up the names in the cache first, the epoch allows to detect
+    // invalidations happening while the remaining names are resolved
+    std::uint64_t epoch = 0;
+    std::vector<std::size_t> misses;
+    misses.reserve(names.size());
+
+    if (caching_)
+    {
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        epoch = symbol_cache_epoch_;
+
+        for (std::size_t i = 0; i != names.size(); ++i)
+        {
+            symbol_cache_type::const_iterator it = symbol_cache_.find(names[i]);
+            if (it != symbol_cache_.end())
+                results[i] = hpx::make_ready_future(it->second);
+            else
+                misses.push_back(i);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i != names.size(); ++i)
+            misses.push_back(i);
+    }
+
+    // collect the remaining names for each symbol namespace instance
+    std::map<naming::id_type, std::vector<std::size_t> > requests;
+    for (std::size_t i : misses)
+    {
+        requests[symbol_namespace::symbol_namespace_locality(names[i])]
+            .push_back(i);
+    }
+
+    for (auto& r : requests)
+    {
+        std::size_t const num_names = r.second.size();
+
+        std::vector<std::string> request_names;
+        std::vector<hpx::id_type> lcos;
+        std::vector<future<hpx::id_type> > pending;
+        request_names.reserve(num_names);
+        lcos.reserve(num_names);
+        pending.reserve(num_names);
+
+        for (std::size_t i : r.second)
+        {
+            // the LCO is triggered only if the name is not bound yet
+            lcos::promise<naming::id_type, naming::gid_type> p;
+            pending.push_back(p.get_future());
+            lcos.push_back(p.get_id());
+            request_names.push_back(names[i]);
+        }
+
+        shared_future<std::vector<naming::id_type> > f =
+            symbol_ns_.on_events(std::move(request_names), std::move(lcos));
+
+        for (std::size_t j = 0; j != num_names; ++j)
+        {
+            std::size_t const i = r.second[j];
+            results[i] = f.then(hpx::launch::sync,
+                [this, j, epoch, name = names[i], p = std::move(pending[j])](
+                    shared_future<std::vector<naming::id_type> > const& f)
+                    mutable -> future<hpx::id_type>
+                {
+                    naming::id_type const& id = f.get()[j];
+                    if (!id)
+                    {
+                        return p.then(hpx::launch::sync,
+                            [this, epoch, name = std::move(name)](
+                                future<hpx::id_type>&& p) -> hpx::id_type
+                            {
+                                hpx::id_type id = p.get();
+                                update_symbol_cache(name, id, epoch);
+                                return id;
+                            });
+                    }
+
+                    update_symbol_cache(name, id, epoch);
+                    return hpx::make_ready_future(id);
+                });
+        }
+    }
+
+    return results;
+}
+
+void addressing_service::update_symbol_cache(
+    std::string const& name
+  , naming::id_type const& id
+  , std::uint64_t epoch
+    )
+{
+    if (!caching_ || !id)
+        return;
+
+    std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+
+    // the name might have been unbound while it was being resolved
+    if (epoch != symbol_cache_epoch_)
+        return;
+
+    symbol_cache_.emplace(name, id);
+}
+
+void addressing_service::invalidate_symbol_cache(std::string const& name)
+{
+    // release the cached id after unlocking the cache
+    naming::id_type id;
+
+    {
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        ++symbol_cache_epoch_;
+
+        symbol_cache_type::iterator it = symbol_cache_.find(name);
+        if (it == symbol_cache_.end())
+            return;
+
+        id = std::move(it->second);
+        symbol_cache_.erase(it);
+    }
+}
+
 // Return all matching entries in the symbol namespace
 hpx::future<addressing_service::iterate_names_return_type>
     addressing_service::iterate_ids(std::string const& pattern)
@@ -1879,17 +1957,6 @@ hpx::future<addressing_service::iterate_names_return_type>
     return symbol_ns_.iterate_async(pattern);
 } // }}}
 
-// This function has to return false if the key is already in the cache (true
-// means go ahead with the cache update).
-bool check_for_collisions(
-    addressing_service::gva_cache_key const& new_key
-  , addressing_service::gva_cache_key const& old_key
-    )
-{
-    return (new_key.get_gid() != old_key.get_gid())
-        || (new_key.get_count() != old_key.get_count());
-}
-
 void addressing_service::update_cache_entry(
     naming::gid_type const& id
   , gva const& g
@@ -1951,30 +2018,22 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
+        if (!gva_cache_->update(key, g))
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
-                {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
-
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
+                // Figure out who we collided with, the entry might have
+                // been evicted in the meantime.
+                addressing_service::gva_cache_key idbase;
+                addressing_service::gva_cache_type::entry_type e;
 
+                if (gva_cache_->get_entry(key, idbase, e))
+                {
                     LAGAS_(warning) << hpx::util::format(
                         "addressing_service::update_cache_entry, "
                         "aborting update due to key collision in cache, "
-                        "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
+                        "new_gid({1}), new_count({2}), old_gid({3}), "
+                        "old_count({4})",
                         gid, count, idbase.get_gid(), idbase.get_count());
                 }
             }
@@ -2003,7 +2062,6 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
     if(gva_cache_->get_entry(k, idbase_key, gva))
     {
         const std::uint64_t id_msb =
@@ -2011,7 +2069,6 @@ bool addressing_service::get_cache_entry(
 
         if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
@@ -2040,8 +2097,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2087,13 +2142,7 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+        gva_cache_->erase(gid);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2110,6 +2159,16 @@ void addressing_service::start_shutdown(error_code& ec)
     if (!caching_)
         return;
 
+    // release the ids held by the symbol cache, the resulting decref
+    // requests are sent below
+    symbol_cache_type symbol_cache;
+    {
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        ++symbol_cache_epoch_;
+        symbol_cache.swap(symbol_cache_);
+    }
+    symbol_cache.clear();
+
     std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
     enable_refcnt_caching_ = false;
     send_refcnt_requests_sync(l, ec);
@@ -2238,81 +2297,104 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.hits(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.misses(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.evictions(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.insertions(reset);
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_get_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_insert_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_update_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_erase_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_get_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_insert_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_update_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return gva_cache_->get_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_erase_entry_time(reset);
+        });
 }
 
 /// Install performance counter types exposing properties from the local cache.
@@ -2509,24 +2591,73 @@ void addressing_service::garbage_collect(
     send_refcnt_requests_sync(l, ec);
 }
 
-void addressing_service::send_refcnt_requests(
+addressing_service::refcnt_requests_shard&
+addressing_service::get_refcnt_shard(naming::gid_type const& id)
+{
+    std::size_t const index = std::hash<naming::gid_type>()(id);
+    return refcnt_shards_[index % num_refcnt_shards].data_;
+}
+
+void addressing_service::extract_refcnt_requests(
     std::unique_lock<addressing_service::mutex_type>& l
-  , error_code& ec
+  , refcnt_requests_type& requests
     )
 {
-    if (!l.owns_lock())
+    HPX_ASSERT(l.owns_lock());
+    HPX_UNUSED(l);
+
+    // requests added concurrently are either extracted below or counted
+    // towards the next flush
+    refcnt_requests_count_ = 0;
+
+    for (util::cache_line_data<refcnt_requests_shard>& s : refcnt_shards_)
+    {
+        refcnt_requests_type shard_requests;
+        {
+            std::lock_guard<mutex_type> sl(s.data_.mtx_);
+            if (s.data_.requests_.empty())
+                continue;
+            shard_requests.swap(s.data_.requests_);
+        }
+
+        // the shards hold disjoint sets of ids
+        if (requests.empty())
+            requests.swap(shard_requests);
+        else
+            requests.insert(shard_requests.begin(), shard_requests.end());
+    }
+}
+
+void addressing_service::start_refcnt_flush_timer()
+{
+    if (refcnt_flush_interval_ == 0 || !enable_refcnt_caching_ ||
+        refcnt_flush_started_.load(std::memory_order_relaxed) ||
+        refcnt_flush_started_.exchange(true))
     {
-        HPX_THROWS_IF(ec, lock_error
-          , "addressing_service::send_refcnt_requests"
-          , "mutex is not locked");
         return;
     }
 
-    if (!enable_refcnt_caching_ || max_refcnt_requests_ == ++refcnt_requests_count_)
-        send_refcnt_requests_non_blocking(l, ec);
+    // the requests cached so far will be sent after one interval
+    refcnt_flush_timer_.start(false);
+}
 
-    else if (&ec != &throws)
-        ec = make_success_code();
+bool addressing_service::flush_refcnt_requests()
+{
+    if (!enable_refcnt_caching_)
+        return false;       // all requests are sent directly
+
+    if (refcnt_requests_count_.load(std::memory_order_relaxed) != 0)
+    {
+        error_code ec(lightweight);
+        garbage_collect_non_blocking(ec);
+        if (ec)
+        {
+            LAGAS_(error) << hpx::util::format(
+                "addressing_service::flush_refcnt_requests, "
+                "failed to send pending requests: {1}", ec.get_message());
+        }
+    }
+    return true;
 }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
@@ -2568,19 +2699,14 @@ void addressing_service::send_refcnt_requests_non_blocking(
     HPX_ASSERT(l.owns_lock());
 
     try {
-        if (refcnt_requests_->empty())
-        {
-            l.unlock();
-            return;
-        }
-
         std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
+        extract_refcnt_requests(l, *p);
 
         l.unlock();
 
+        if (p->empty())
+            return;
+
         LAGAS_(info) << hpx::util::format(
             "addressing_service::send_refcnt_requests_non_blocking, "
             "requests({1})",
@@ -2628,7 +2754,8 @@ void addressing_service::send_refcnt_requests_non_blocking(
             ec = make_success_code();
     }
     catch (hpx::exception const& e) {
-        l.unlock();
+        if (l.owns_lock())
+            l.unlock();
         HPX_RETHROWS_IF(ec, e,
             "addressing_service::send_refcnt_requests_non_blocking");
     }
@@ -2641,19 +2768,14 @@ addressing_service::send_refcnt_requests_async(
 {
     HPX_ASSERT(l.owns_lock());
 
-    if (refcnt_requests_->empty())
-    {
-        l.unlock();
-        return std::vector<hpx::future<std::vector<std::int64_t> > >();
-    }
-
     std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-    p.swap(refcnt_requests_);
-    refcnt_requests_count_ = 0;
+    extract_refcnt_requests(l, *p);
 
     l.unlock();
 
+    if (p->empty())
+        return std::vector<hpx::future<std::vector<std::int64_t> > >();
+
     LAGAS_(info) << hpx::util::format(
         "addressing_service::send_refcnt_requests_async, "
         "requests({1})",
@@ -2734,6 +2856,19 @@ hpx::future<void> addressing_service::mark_as_migrated(
 
     HPX_ASSERT(naming::detail::is_migratable(gid_));
 
+    naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+    migrated_objects_shard& shard = get_migrated_objects_shard(gid);
+
+    // Announce the object to be marked, this forces was_object_migrated to
+    // lock the shard. Wait for the readers which may have pinned the object
+    // without having seen the announcement, the user supplied function will
+    // see their pins. New readers don't register after the announcement, so
+    // this wait is bounded.
+    ++shard.size_;
+    util::yield_while(
+        [&shard]() -> bool { return shard.readers_.data_.load() != 0; },
+        "addressing_service::mark_as_migrated");
+
     // Always first grab the AGAS lock before invoking the user supplied
     // function. The user supplied code will grab another lock. Both locks have
     // to be acquired and always in the same sequence.
@@ -2743,33 +2878,35 @@ hpx::future<void> addressing_service::mark_as_migrated(
     // this locality is to query the migrated objects table in AGAS.
     using lock_type = std::unique_lock<mutex_type>;
 
-    lock_type lock(migrated_objects_mtx_);
+    lock_type lock(shard.mtx_);
     util::ignore_while_checking<lock_type> ignore(&lock);
 
     // call the user code for the component instance to be migrated, the
     // returned future becomes ready whenever the component instance can be
     // migrated (no threads are pending/active any more)
-    std::pair<bool, hpx::future<void> > result = f();
+    std::pair<bool, hpx::future<void> > result;
+    try {
+        result = f();
+    }
+    catch (...) {
+        --shard.size_;
+        throw;
+    }
 
     // mark the gid as 'migrated' right away - the worst what can happen is
     // that a parcel which comes in for this object is bouncing between this
     // locality and the locality managing the address resolution for the object
     if (result.first)
     {
-        naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
-
-        migrated_objects_table_type::iterator it =
-            migrated_objects_table_.find(gid);
-
         // insert the object into the map of migrated objects
-        if (it == migrated_objects_table_.end())
+        if (shard.table_.insert(gid).second)
         {
             HPX_ASSERT(!expect_to_be_marked_as_migrating);
-            migrated_objects_table_.insert(gid);
         }
         else
         {
             HPX_ASSERT(expect_to_be_marked_as_migrating);
+            --shard.size_;
         }
 
         // avoid interactions with the locking in the cache
@@ -2778,6 +2915,10 @@ hpx::future<void> addressing_service::mark_as_migrated(
         // remove entry from cache
         remove_cache_entry(gid_);
     }
+    else
+    {
+        --shard.size_;
+    }
 
     return std::move(result.second);
 }
@@ -2797,16 +2938,14 @@ void addressing_service::unmark_as_migrated(
     HPX_ASSERT(naming::detail::is_migratable(gid_));
 
     naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+    migrated_objects_shard& shard = get_migrated_objects_shard(gid);
 
-    std::unique_lock<mutex_type> lock(migrated_objects_mtx_);
-
-    migrated_objects_table_type::iterator it =
-        migrated_objects_table_.find(gid);
+    std::unique_lock<mutex_type> lock(shard.mtx_);
 
     // remove the object from the map of migrated objects
-    if (it != migrated_objects_table_.end())
+    if (shard.table_.erase(gid) != 0)
     {
-        migrated_objects_table_.erase(it);
+        --shard.size_;
 
         // remove entry from cache
         if (caching_ && naming::detail::store_in_cache(gid_))
@@ -2857,24 +2996,44 @@ bool addressing_service::end_migration(
     return primary_ns_.end_migration(gid);
 }
 
+addressing_service::migrated_objects_shard&
+addressing_service::get_migrated_objects_shard(naming::gid_type const& id)
+{
+    std::size_t const index = std::hash<naming::gid_type>()(id);
+    return migrated_objects_[index % num_migrated_objects_shards].data_;
+}
+
 bool addressing_service::was_object_migrated_locked(
+    migrated_objects_shard& shard
+  , naming::gid_type const& gid_
+    )
+{
+    naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+
+    return shard.table_.find(gid) != shard.table_.end();
+}
+
+bool addressing_service::was_object_migrated_hint(
     naming::gid_type const& gid_
     )
 {
     naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+    migrated_objects_shard& shard = get_migrated_objects_shard(gid);
+
+    if (shard.size_.load(std::memory_order_acquire) == 0)
+        return false;
 
-    return
-        migrated_objects_table_.find(gid) !=
-        migrated_objects_table_.end();
+    std::lock_guard<mutex_type> lock(shard.mtx_);
+    return was_object_migrated_locked(shard, gid);
 }
 
 std::pair<bool, components::pinned_ptr>
     addressing_service::was_object_migrated(
-        naming::gid_type const& gid
+        naming::gid_type const& gid_
       , util::unique_function_nonser<components::pinned_ptr()> && f //-V669
         )
 {
-    if (!gid)
+    if (!gid_)
     {
         HPX_THROW_EXCEPTION(bad_parameter,
             "addressing_service::was_object_migrated",
@@ -2882,11 +3041,45 @@ std::pair<bool, components::pinned_ptr>
         return std::make_pair(false, components::pinned_ptr());
     }
 
-    if (!naming::detail::is_migratable(gid))
+    if (!naming::detail::is_migratable(gid_))
     {
         return std::make_pair(false, f());
     }
 
+    naming::gid_type gid(naming::detail::get_stripped_gid(gid_));
+    migrated_objects_shard& shard = get_migrated_objects_shard(gid);
+
+    // Fast path: no object of this shard is (being) marked as migrated. The
+    // object is pinned without locking the shard. mark_as_migrated either
+    // sees this reader (and waits for it before inspecting the pin count) or
+    // this reader sees the announcement of mark_as_migrated (and falls back
+    // to locking the shard below). Readers arriving after the announcement
+    // don't register themselves, mark_as_migrated only has to wait for the
+    // ones which have checked size_ before.
+    //
+    // The first check only avoids touching readers_ if the shard is in use
+    // anyway, the check after registering the reader decides.
+    if (shard.size_.load(std::memory_order_relaxed) == 0)
+    {
+        std::atomic<std::size_t>& readers = shard.readers_.data_;
+
+        ++readers;
+        if (shard.size_.load() == 0)
+        {
+            components::pinned_ptr p;
+            try {
+                p = f();
+            }
+            catch (...) {
+                --readers;
+                throw;
+            }
+            --readers;
+            return std::make_pair(false, std::move(p));
+        }
+        --readers;
+    }
+
     // Always first grab the AGAS lock before invoking the user supplied
     // function. The user supplied code will grab another lock. Both locks have
     // to be acquired and always in the same sequence.
@@ -2896,9 +3089,9 @@ std::pair<bool, components::pinned_ptr>
     // this locality is to query the migrated objects table in AGAS.
     typedef std::unique_lock<mutex_type> lock_type;
 
-    lock_type lock(migrated_objects_mtx_);
+    lock_type lock(shard.mtx_);
 
-    if (was_object_migrated_locked(gid))
+    if (was_object_migrated_locked(shard, gid))
         return std::make_pair(true, components::pinned_ptr());
 
     util::ignore_while_checking<lock_type> ignore(&lock);
@@ -2942,14 +3135,13 @@ namespace hpx
                 "no basename specified");
         }
 
-        std::vector<hpx::future<hpx::id_type> > results;
+        std::vector<std::string> names;
+        names.reserve(num_ids);
         for(std::size_t i = 0; i != num_ids; ++i)
         {
-            std::string name = detail::name_from_basename(basename, i);
-            results.push_back(agas::on_symbol_namespace_event(
-                std::move(name), true));
+            names.push_back(detail::name_from_basename(basename, i));
         }
-        return results;
+        return agas::on_symbol_namespace_events(names);
     }
 
     std::vector<hpx::future<hpx::id_type>> find_from_basename(
@@ -2962,15 +3154,14 @@ namespace hpx
                 "no basename specified");
         }
 
-        std::vector<hpx::future<hpx::id_type> > results;
+        std::vector<std::string> names;
+        names.reserve(ids.size());
         for (std::size_t i : ids)
         {
-            std::string name =
-                detail::name_from_basename(basename, i);    //-V106
-            results.push_back(agas::on_symbol_namespace_event(
-                std::move(name), true));
+            names.push_back(
+                detail::name_from_basename(basename, i));    //-V106
         }
-        return results;
+        return agas::on_symbol_namespace_events(names);
     }
 
     hpx::future<hpx::id_type> find_from_basename(std::string basename,
@@ -2989,8 +3180,9 @@ namespace hpx
                 std::size_t(naming::get_locality_id_from_id(find_here()));
         }
 
-        std::string name = detail::name_from_basename(basename, sequence_nr);
-        return agas::on_symbol_namespace_event(std::move(name), true);
+        std::vector<std::string> names;
+        names.push_back(detail::name_from_basename(basename, sequence_nr));
+        return std::move(agas::on_symbol_namespace_events(names).front());
     }
 
     hpx::future<bool> register_with_basename(std::string basename,
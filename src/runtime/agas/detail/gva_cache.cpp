@@ -0,0 +1,723 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+#include <hpx/runtime/naming/name.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    namespace
+    {
+        // shards should hold at least this many entries
+        constexpr std::size_t min_shard_size = 16;
+
+        std::size_t round_up_to_power_of_two(std::size_t n)
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        std::uint64_t mix(std::uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr std::uint64_t range_block_mask =
+            (std::uint64_t(1) << gva_cache::range_block_bits) - 1;
+
+        // Returns whether the (range) entry g with the given base id
+        // resolves gid to the address of next.
+        bool resolves_to(gva const& g, naming::gid_type const& base,
+            naming::gid_type const& gid, gva const& next)
+        {
+            return g.prefix == next.prefix && g.type == next.type &&
+                g.lva(gid, base) == next.lva();
+        }
+
+        std::size_t count_pieces(gva_cache_key const& key)
+        {
+            naming::gid_type const first = key.get_gid();
+            naming::gid_type const last = key.get_last_gid();
+            if (first.get_msb() != last.get_msb())
+                return (std::numeric_limits<std::size_t>::max)();
+
+            return static_cast<std::size_t>(
+                (last.get_lsb() >> gva_cache::range_block_bits) -
+                (first.get_lsb() >> gva_cache::range_block_bits) + 1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t max_size, std::size_t concurrency,
+            bool combine_entries)
+      : max_size_(max_size)
+      , combine_entries_(combine_entries)
+    {
+        if (concurrency == 0)
+        {
+            concurrency = (std::max)(
+                std::size_t(std::thread::hardware_concurrency()),
+                std::size_t(1));
+        }
+
+        // use a few shards per thread to keep the probability of collisions
+        // low, as long as the shards don't get too small
+        std::size_t num_shards = round_up_to_power_of_two(4 * concurrency);
+        while (num_shards > 1 && max_size / num_shards < min_shard_size)
+            num_shards /= 2;
+
+        shards_.reserve(num_shards);
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shards_.emplace_back(new shard);
+        }
+
+        std::size_t const capacity = shard_capacity(max_size);
+        for (std::unique_ptr<shard>& s : shards_)
+        {
+            s->max_size_ = capacity;
+        }
+    }
+
+    std::size_t gva_cache::shard_capacity(std::size_t max_size) const
+    {
+        std::size_t const n = shards_.size();
+        return (std::max)((max_size + n - 1) / n, std::size_t(1));
+    }
+
+    gva_cache::shard& gva_cache::get_shard(naming::gid_type const& gid)
+    {
+        std::size_t const i = static_cast<std::size_t>(
+            mix(gid.get_msb() ^ mix(gid.get_lsb())));
+        return *shards_[i & (shards_.size() - 1)];
+    }
+
+    gva_cache::shard& gva_cache::get_range_shard(naming::gid_type const& gid)
+    {
+        std::size_t const i = static_cast<std::size_t>(
+            mix(gid.get_msb() ^ mix(gid.get_lsb() >> range_block_bits)));
+        return *shards_[i & (shards_.size() - 1)];
+    }
+
+    template <typename F>
+    void gva_cache::for_each_piece(key_type const& key, F&& f)
+    {
+        naming::gid_type const first = key.get_gid();
+        std::uint64_t const msb = first.get_msb();
+        std::uint64_t const last = key.get_last_gid().get_lsb();
+
+        HPX_ASSERT(msb == key.get_last_gid().get_msb());
+
+        std::uint64_t lsb = first.get_lsb();
+        while (true)
+        {
+            std::uint64_t const piece_last =
+                (std::min)(lsb | range_block_mask, last);
+
+            naming::gid_type const piece_first(msb, lsb);
+            f(get_range_shard(piece_first), piece_first,
+                naming::gid_type(msb, piece_last));
+
+            if (piece_last == last)
+                break;
+            lsb = piece_last + 1;
+        }
+    }
+
+    std::size_t gva_cache::size() const
+    {
+        std::size_t result = 0;
+        for (std::unique_ptr<shard> const& s : shards_)
+        {
+            std::lock_guard<mutex_type> l(s->mtx_.data_);
+            result += s->size();
+        }
+        return result;
+    }
+
+    void gva_cache::reserve(std::size_t max_size)
+    {
+        max_size_ = max_size;
+
+        std::size_t const capacity = shard_capacity(max_size);
+        for (std::unique_ptr<shard>& s : shards_)
+        {
+            std::lock_guard<mutex_type> l(s->mtx_.data_);
+            s->reserve(capacity);
+        }
+    }
+
+    bool gva_cache::get_entry(
+        key_type const& key, key_type& realkey, entry_type& entry)
+    {
+        naming::gid_type const gid = key.get_gid();
+
+        shard& rs = get_range_shard(gid);
+        bool const check_ranges =
+            rs.num_ranges_.load(std::memory_order_relaxed) != 0;
+
+        {
+            shard& s = get_shard(gid);
+
+            std::lock_guard<mutex_type> l(s.mtx_.data_);
+            statistics_type::update_on_exit update(
+                s.statistics_, util::cache::statistics::method_get_entry);
+
+            if (s.get_single(gid, realkey, entry))
+            {
+                s.statistics_.got_hit();
+                return true;
+            }
+
+            if (!check_ranges)
+            {
+                s.statistics_.got_miss();
+                return false;
+            }
+        }
+
+        std::lock_guard<mutex_type> l(rs.mtx_.data_);
+        statistics_type::update_on_exit update(
+            rs.statistics_, util::cache::statistics::method_get_entry);
+
+        if (rs.get_range(gid, realkey, entry))
+        {
+            rs.statistics_.got_hit();
+            return true;
+        }
+
+        rs.statistics_.got_miss();
+        return false;
+    }
+
+    bool gva_cache::update(key_type const& key, entry_type const& entry)
+    {
+        if (key.get_gid() == key.get_last_gid())
+            return update_single(key, entry);
+        return update_range(key, entry);
+    }
+
+    bool gva_cache::update_single(key_type const& key, entry_type const& entry)
+    {
+        naming::gid_type const gid = key.get_gid();
+        shard& s = get_shard(gid);
+
+        // replace an existing entry for the same id
+        {
+            std::lock_guard<mutex_type> l(s.mtx_.data_);
+            if (s.replace_single(key, entry))
+                return true;
+        }
+
+        // the id might be covered by (or directly follow) a range
+        shard& rs = get_range_shard(gid);
+        if (rs.num_ranges_.load(std::memory_order_relaxed) != 0)
+        {
+            bool collision = false;
+            {
+                std::lock_guard<mutex_type> l(rs.mtx_.data_);
+                switch (rs.match_range(key, entry, combine_entries_))
+                {
+                case range_match::consistent:
+                case range_match::extended:
+                    return true;
+
+                case range_match::collision:
+                    collision = true;
+                    break;
+
+                case range_match::none:
+                    break;
+                }
+            }
+
+            // the range resolves the id differently, i.e. it is stale, drop
+            // it and cache the new entry by itself
+            if (collision)
+                erase_range(gid);
+        }
+
+        // combine the entry with the entry for the preceding id, if both
+        // are in the same block
+        std::uint64_t const lsb = gid.get_lsb();
+        if (combine_entries_ && (lsb & range_block_mask) != 0)
+        {
+            naming::gid_type const prev(gid.get_msb(), lsb - 1);
+
+            shard& ps = get_shard(prev);
+
+            entry_type combined;
+            bool found = false;
+            {
+                std::lock_guard<mutex_type> l(ps.mtx_.data_);
+                found = ps.combine_predecessor(prev, entry, combined);
+            }
+
+            if (found)
+            {
+                {
+                    std::lock_guard<mutex_type> l(rs.mtx_.data_);
+                    found = rs.update_range(
+                        key_type(prev, 2), combined, prev, gid);
+                }
+
+                // the entry for the preceding id is removed only once the
+                // combined entry is in place
+                if (found)
+                {
+                    std::lock_guard<mutex_type> l(ps.mtx_.data_);
+                    ps.remove_single(prev);
+                    return true;
+                }
+            }
+        }
+
+        std::lock_guard<mutex_type> l(s.mtx_.data_);
+        s.update_single(key, entry);
+        return true;
+    }
+
+    bool gva_cache::update_range(key_type const& key, entry_type const& entry)
+    {
+        // cache only the first id of ranges which would occupy too many
+        // entries
+        if (count_pieces(key) > max_range_pieces)
+        {
+            naming::gid_type const first = key.get_gid();
+            return update_single(key_type(first), entry.resolve(first, first));
+        }
+
+        bool result = true;
+        for_each_piece(key,
+            [&](shard& s, naming::gid_type const& first,
+                naming::gid_type const& last) {
+                std::lock_guard<mutex_type> l(s.mtx_.data_);
+                if (!s.update_range(key, entry, first, last))
+                    result = false;
+            });
+        return result;
+    }
+
+    void gva_cache::erase(naming::gid_type const& gid)
+    {
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+
+        {
+            shard& s = get_shard(id);
+
+            std::lock_guard<mutex_type> l(s.mtx_.data_);
+            s.erase_single(id);
+        }
+
+        erase_range(id);
+    }
+
+    void gva_cache::erase_range(naming::gid_type const& gid)
+    {
+        key_type key;
+        bool found = false;
+        {
+            shard& rs = get_range_shard(gid);
+
+            std::lock_guard<mutex_type> l(rs.mtx_.data_);
+            found = rs.erase_range(gid, key);
+        }
+
+        // remove the remaining pieces of the range
+        if (found && count_pieces(key) > 1)
+        {
+            for_each_piece(key,
+                [&](shard& s, naming::gid_type const&,
+                    naming::gid_type const&) {
+                    std::lock_guard<mutex_type> l(s.mtx_.data_);
+                    s.erase_piece(key);
+                });
+        }
+    }
+
+    void gva_cache::clear()
+    {
+        for (std::unique_ptr<shard>& s : shards_)
+        {
+            std::lock_guard<mutex_type> l(s->mtx_.data_);
+            s->clear();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::shard::get_single(
+        naming::gid_type const& gid, key_type& realkey, entry_type& entry)
+    {
+        auto it = singles_.find(gid);
+        if (it == singles_.end())
+            return false;
+
+        slot& s = slots_[it->second];
+        s.referenced_ = true;
+
+        realkey = s.key_;
+        entry = s.entry_;
+        return true;
+    }
+
+    bool gva_cache::shard::get_range(
+        naming::gid_type const& gid, key_type& realkey, entry_type& entry)
+    {
+        auto it = find_range(gid);
+        if (it == ranges_.end())
+            return false;
+
+        slot& s = slots_[it->slot_];
+        s.referenced_ = true;
+
+        realkey = s.key_;
+        entry = s.entry_;
+        return true;
+    }
+
+    std::vector<gva_cache::range_index_entry>::iterator
+    gva_cache::shard::find_range(naming::gid_type const& gid)
+    {
+        auto it = std::upper_bound(ranges_.begin(), ranges_.end(), gid,
+            [](naming::gid_type const& id, range_index_entry const& r) {
+                return id < r.first_;
+            });
+
+        if (it == ranges_.begin())
+            return ranges_.end();
+
+        --it;
+        if (it->last_ < gid)
+            return ranges_.end();
+
+        return it;
+    }
+
+    bool gva_cache::shard::replace_single(
+        key_type const& key, entry_type const& entry)
+    {
+        auto it = singles_.find(key.get_gid());
+        if (it == singles_.end())
+            return false;
+
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_update_entry);
+
+        slot& s = slots_[it->second];
+        s.entry_ = entry;
+        s.referenced_ = true;
+
+        statistics_.got_hit();
+        return true;
+    }
+
+    void gva_cache::shard::update_single(
+        key_type const& key, entry_type const& entry)
+    {
+        if (replace_single(key, entry))
+            return;
+
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_update_entry);
+        statistics_.got_miss();
+
+        statistics_type::update_on_exit update_insert(
+            statistics_, util::cache::statistics::method_insert_entry);
+        insert(key, entry, key.get_gid(), key.get_gid(), false);
+    }
+
+    gva_cache::range_match gva_cache::shard::match_range(
+        key_type const& key, entry_type const& entry, bool extend)
+    {
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_update_entry);
+
+        naming::gid_type const gid = key.get_gid();
+
+        auto it = find_range(gid);
+        if (it != ranges_.end())
+        {
+            slot& s = slots_[it->slot_];
+            if (!resolves_to(s.entry_, s.key_.get_gid(), gid, entry))
+                return range_match::collision;
+
+            s.referenced_ = true;
+            statistics_.got_hit();
+            return range_match::consistent;
+        }
+
+        // extend a range ending right before the id (within the block),
+        // ranges which were split into pieces are left alone
+        std::uint64_t const lsb = gid.get_lsb();
+        if (!extend || (lsb & range_block_mask) == 0)
+            return range_match::none;
+
+        naming::gid_type const prev(gid.get_msb(), lsb - 1);
+        it = find_range(prev);
+        if (it == ranges_.end())
+            return range_match::none;
+
+        slot& s = slots_[it->slot_];
+        if (s.key_.get_gid() != it->first_ || s.key_.get_last_gid() != prev ||
+            s.entry_.offset == 0 ||
+            !resolves_to(s.entry_, it->first_, gid, entry))
+        {
+            return range_match::none;
+        }
+
+        s.key_ = key_type(it->first_, lsb - it->first_.get_lsb() + 1);
+        ++s.entry_.count;
+        s.referenced_ = true;
+        it->last_ = gid;
+
+        statistics_.got_hit();
+        return range_match::extended;
+    }
+
+    bool gva_cache::shard::update_range(key_type const& key,
+        entry_type const& entry, naming::gid_type const& first,
+        naming::gid_type const& last)
+    {
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_update_entry);
+
+        // find a piece overlapping with [first, last]
+        auto it = std::upper_bound(ranges_.begin(), ranges_.end(), first,
+            [](naming::gid_type const& id, range_index_entry const& r) {
+                return id < r.first_;
+            });
+
+        auto overlap = ranges_.end();
+        if (it != ranges_.begin() && !((it - 1)->last_ < first))
+            overlap = it - 1;
+        else if (it != ranges_.end() && !(last < it->first_))
+            overlap = it;
+
+        if (overlap != ranges_.end())
+        {
+            // don't replace an entry covering a different range of ids
+            slot& s = slots_[overlap->slot_];
+            if (overlap->first_ != first || overlap->last_ != last ||
+                s.key_.get_gid() != key.get_gid() ||
+                s.key_.get_last_gid() != key.get_last_gid())
+            {
+                return false;
+            }
+
+            s.entry_ = entry;
+            s.referenced_ = true;
+
+            statistics_.got_hit();
+            return true;
+        }
+
+        statistics_.got_miss();
+
+        statistics_type::update_on_exit update_insert(
+            statistics_, util::cache::statistics::method_insert_entry);
+        insert(key, entry, first, last, true);
+        return true;
+    }
+
+    bool gva_cache::shard::combine_predecessor(naming::gid_type const& gid,
+        entry_type const& next, entry_type& combined)
+    {
+        auto it = singles_.find(gid);
+        if (it == singles_.end())
+            return false;
+
+        entry_type const& e = slots_[it->second].entry_;
+        if (e.prefix != next.prefix || e.type != next.type ||
+            e.lva() >= next.lva())
+        {
+            return false;
+        }
+
+        combined = entry_type(
+            e.prefix, e.type, 2, e.lva(), next.lva() - e.lva());
+        return true;
+    }
+
+    void gva_cache::shard::remove_single(naming::gid_type const& gid)
+    {
+        auto it = singles_.find(gid);
+        if (it != singles_.end())
+            remove(it->second);
+    }
+
+    void gva_cache::shard::erase_single(naming::gid_type const& gid)
+    {
+        auto it = singles_.find(gid);
+        if (it == singles_.end())
+            return;
+
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_erase_entry);
+
+        remove(it->second);
+        statistics_.got_eviction();
+    }
+
+    bool gva_cache::shard::erase_range(
+        naming::gid_type const& gid, key_type& key)
+    {
+        auto it = find_range(gid);
+        if (it == ranges_.end())
+            return false;
+
+        statistics_type::update_on_exit update(
+            statistics_, util::cache::statistics::method_erase_entry);
+
+        key = slots_[it->slot_].key_;
+        remove(it->slot_);
+        statistics_.got_eviction();
+        return true;
+    }
+
+    void gva_cache::shard::erase_piece(key_type const& key)
+    {
+        for (range_index_entry const& r : ranges_)
+        {
+            slot const& s = slots_[r.slot_];
+            if (s.key_.get_gid() == key.get_gid() &&
+                s.key_.get_last_gid() == key.get_last_gid())
+            {
+                statistics_type::update_on_exit update(
+                    statistics_, util::cache::statistics::method_erase_entry);
+
+                remove(r.slot_);
+                statistics_.got_eviction();
+                return;
+            }
+        }
+    }
+
+    void gva_cache::shard::insert(key_type const& key,
+        entry_type const& entry, naming::gid_type const& first,
+        naming::gid_type const& last, bool range)
+    {
+        if (size() >= max_size_)
+            evict();
+
+        std::size_t pos = slots_.size();
+        if (!free_slots_.empty())
+        {
+            pos = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        else
+        {
+            slots_.emplace_back();
+        }
+
+        slot& s = slots_[pos];
+        s.key_ = key;
+        s.entry_ = entry;
+        s.first_ = first;
+        s.used_ = true;
+        s.referenced_ = false;
+        s.range_ = range;
+
+        if (range)
+        {
+            auto it = std::upper_bound(ranges_.begin(), ranges_.end(), first,
+                [](naming::gid_type const& id, range_index_entry const& r) {
+                    return id < r.first_;
+                });
+            ranges_.insert(it, range_index_entry{first, last, pos});
+            num_ranges_.store(ranges_.size(), std::memory_order_relaxed);
+        }
+        else
+        {
+            singles_.emplace(first, pos);
+        }
+
+        statistics_.got_insertion();
+    }
+
+    void gva_cache::shard::remove(std::size_t pos)
+    {
+        slot& s = slots_[pos];
+        HPX_ASSERT(s.used_);
+
+        if (s.range_)
+        {
+            auto it = std::lower_bound(ranges_.begin(), ranges_.end(),
+                s.first_,
+                [](range_index_entry const& r, naming::gid_type const& id) {
+                    return r.first_ < id;
+                });
+            HPX_ASSERT(it != ranges_.end() && it->slot_ == pos);
+            ranges_.erase(it);
+            num_ranges_.store(ranges_.size(), std::memory_order_relaxed);
+        }
+        else
+        {
+            singles_.erase(s.first_);
+        }
+
+        s.used_ = false;
+        free_slots_.push_back(pos);
+    }
+
+    void gva_cache::shard::evict()
+    {
+        HPX_ASSERT(size() != 0);
+
+        // advance the CLOCK hand to the next entry which was not referenced
+        // since the hand passed it the last time
+        while (true)
+        {
+            if (hand_ >= slots_.size())
+                hand_ = 0;
+
+            slot& s = slots_[hand_];
+            if (s.used_ && !s.referenced_)
+                break;
+
+            s.referenced_ = false;
+            ++hand_;
+        }
+
+        remove(hand_);
+        ++hand_;
+
+        statistics_.got_eviction();
+    }
+
+    void gva_cache::shard::clear()
+    {
+        singles_.clear();
+        ranges_.clear();
+        slots_.clear();
+        free_slots_.clear();
+        hand_ = 0;
+        num_ranges_.store(0, std::memory_order_relaxed);
+    }
+
+    void gva_cache::shard::reserve(std::size_t max_size)
+    {
+        max_size_ = max_size;
+        while (size() > max_size_)
+            evict();
+    }
+}}}
@@ -506,6 +506,13 @@ hpx::future<hpx::id_type> on_symbol_namespace_event(
     return resolver.on_symbol_namespace_event(name, call_for_past_events);
 }
 
+std::vector<hpx::future<hpx::id_type>> on_symbol_namespace_events(
+    std::vector<std::string> const& names)
+{
+    naming::resolver_client& resolver = naming::get_agas_client();
+    return resolver.on_symbol_namespace_events(names);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 hpx::future<std::pair<naming::id_type, naming::address>>
     begin_migration(naming::id_type const& id)
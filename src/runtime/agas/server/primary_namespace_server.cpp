@@ -33,10 +33,12 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -231,7 +233,8 @@ primary_namespace::begin_migration(naming::gid_type id)
     counter_data_.increment_begin_migration_count();
     using hpx::util::get;
 
-    std::unique_lock<mutex_type> l(mutex_);
+    shard& s = get_shard(id);
+    std::unique_lock<mutex_type> l(s.mutex_);
 
     wait_for_migration_locked(l, id, hpx::throws);
     resolved_type r = resolve_gid_locked(l, id, hpx::throws);
@@ -246,11 +249,11 @@ primary_namespace::begin_migration(naming::gid_type id)
         return std::make_pair(naming::invalid_id, naming::address());
     }
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
+    migration_table_type::iterator it = s.migrating_objects_.find(id);
+    if (it == s.migrating_objects_.end())
     {
         std::pair<migration_table_type::iterator, bool> p =
-            migrating_objects_.emplace(std::piecewise_construct,
+            s.migrating_objects_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(id), std::forward_as_tuple());
         HPX_ASSERT(p.second);
         it = p.first;
@@ -278,12 +281,13 @@ bool primary_namespace::end_migration(naming::gid_type const& id)
     );
     counter_data_.increment_end_migration_count();
 
-    std::unique_lock<mutex_type> l(mutex_);
+    shard& s = get_shard(id);
+    std::unique_lock<mutex_type> l(s.mutex_);
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end())
+    migration_table_type::iterator it = s.migrating_objects_.find(id);
+    if (it != s.migrating_objects_.end())
     {
         // flag this id as not being migrated anymore
         get<0>(it->second) = false;
@@ -293,7 +297,7 @@ bool primary_namespace::end_migration(naming::gid_type const& id)
         }
         else
         {
-            migrating_objects_.erase(it);
+            s.migrating_objects_.erase(it);
         }
     }
 
@@ -306,10 +310,13 @@ void primary_namespace::wait_for_migration_locked(
 {
     HPX_ASSERT_OWNS_LOCK(l);
 
+    shard& s = get_shard(id);
+    HPX_ASSERT(l.mutex() == &s.mutex_);
+
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end())
+    migration_table_type::iterator it = s.migrating_objects_.find(id);
+    if (it != s.migrating_objects_.end())
     {
         if (get<0>(it->second))
         {
@@ -318,13 +325,13 @@ void primary_namespace::wait_for_migration_locked(
             get<2>(it->second).wait(l, ec);
 
             if (--get<1>(it->second) == 0)
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
         }
         else
         {
             if (get<1>(it->second) == 0)
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
     }
@@ -341,130 +348,135 @@ bool primary_namespace::bind_gid(
         counter_data_.bind_gid_.enabled_
     );
     counter_data_.increment_bind_gid_count();
-    using hpx::util::get;
 
     naming::gid_type gid = id;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    shard& s = get_shard(id);
+    std::unique_lock<mutex_type> l(s.mutex_);
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    // the table of ranges is needed only when binding a range or if a range
+    // could cover the new id
+    std::unique_lock<mutex_type> rl(ranges_mutex_.data_, std::defer_lock);
 
-    if (it != end)
-    {
-        // If we got an exact match, this is a request to update an existing
-        // binding (e.g. move semantics).
-        if (it->first == id)
-        {
-            // non-migratable gids can't be rebound
-            if (naming::refers_to_local_lva(gid) &&
-                !naming::refers_to_virtual_memory(gid))
-            {
-                l.unlock();
+    auto unlock = [&]() {
+        if (rl.owns_lock())
+            rl.unlock();
+        l.unlock();
+    };
 
-                HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
-                    "cannot rebind gids for non-migratable objects");
+    gva_table_data_type* data = nullptr;
 
-                return false;
-            }
+    gva_table_type::iterator it = s.gvas_.find(id);
+    if (it != s.gvas_.end())
+    {
+        data = &it->second;
+    }
+    else if (g.count > 1 || num_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        rl.lock();
 
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
+        gva_range_table_type::iterator rit = ranges_.upper_bound(id);
+        if (rit != ranges_.begin())
+        {
+            --rit;
 
-            // Check for count mismatch (we can't change block sizes of
-            // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+            if (rit->first == id)
             {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "cannot change block size of existing binding");
+                data = &rit->second;
             }
 
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
+            // Check that a previous range doesn't cover the new id.
+            else if (HPX_UNLIKELY((rit->first + rit->second.first.count) > id))
             {
-                l.unlock();
+                // REVIEW: Is this the right error code to use?
+                unlock();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
+                  , "the new GID is contained in an existing range");
             }
+        }
+    }
 
-            if (HPX_UNLIKELY(!locality))
-            {
-                l.unlock();
+    // If we got an exact match, this is a request to update an existing
+    // binding (e.g. move semantics).
+    if (data != nullptr)
+    {
+        // non-migratable gids can't be rebound
+        if (naming::refers_to_local_lva(gid) &&
+            !naming::refers_to_virtual_memory(gid))
+        {
+            unlock();
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
-            }
+            HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
+                "cannot rebind gids for non-migratable objects");
 
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
+            return false;
+        }
 
-            l.unlock();
+        gva& gaddr = data->first;
+        naming::gid_type& loc = data->second;
 
-            LAGAS_(info) << hpx::util::format(
-                "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                "locality({3}), response(repeated_request)",
-                id, g, locality);
+        // Check for count mismatch (we can't change block sizes of
+        // existing bindings).
+        if (HPX_UNLIKELY(gaddr.count != g.count))
+        {
+            // REVIEW: Is this the right error code to use?
+            unlock();
 
-            return false;
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "primary_namespace::bind_gid"
+              , "cannot change block size of existing binding");
         }
 
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
+            unlock();
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "the new GID is contained in an existing range");
-            }
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "primary_namespace::bind_gid"
+              , hpx::util::format(
+                    "attempt to update a GVA with an invalid type, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality));
         }
-    }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
+        if (HPX_UNLIKELY(!locality))
         {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
+              , hpx::util::format(
+                    "attempt to update a GVA with an invalid locality id, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality));
         }
+
+        // Store the new endpoint and offset
+        gaddr.prefix = g.prefix;
+        gaddr.type   = g.type;
+        gaddr.lva(g.lva());
+        gaddr.offset = g.offset;
+        loc = locality;
+
+        unlock();
+
+        LAGAS_(info) << hpx::util::format(
+            "primary_namespace::bind_gid, gid({1}), gva({2}), "
+            "locality({3}), response(repeated_request)",
+            id, g, locality);
+
+        return false;
     }
 
     // non-migratable gids don't need to be bound
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
     {
+        unlock();
+
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
             gid, g, locality);
@@ -476,7 +488,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
+        unlock();
 
         HPX_THROW_EXCEPTION(internal_server_error
           , "primary_namespace::bind_gid"
@@ -485,7 +497,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
+        unlock();
 
         HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
@@ -496,10 +508,23 @@ bool primary_namespace::bind_gid(
     }
 
     // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    bool inserted = false;
+    if (g.count > 1)
     {
-        l.unlock();
+        HPX_ASSERT(rl.owns_lock());
+        inserted = util::insert_checked(ranges_.insert(
+            std::make_pair(id, std::make_pair(g, locality))));
+        num_ranges_.store(ranges_.size(), std::memory_order_release);
+    }
+    else
+    {
+        inserted = util::insert_checked(s.gvas_.insert(
+            std::make_pair(id, std::make_pair(g, locality))));
+    }
+
+    if (HPX_UNLIKELY(!inserted))
+    {
+        unlock();
 
         HPX_THROW_EXCEPTION(lock_error
           , "primary_namespace::bind_gid"
@@ -509,7 +534,7 @@ bool primary_namespace::bind_gid(
                 id, g, locality));
     }
 
-    l.unlock();
+    unlock();
 
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -531,7 +556,7 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(
     resolved_type r;
 
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        std::unique_lock<mutex_type> l(get_shard(id).mutex_);
 
         // wait for any migration to be completed
         if (naming::detail::is_migratable(id))
@@ -577,12 +602,15 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    shard& s = get_shard(id);
+    std::unique_lock<mutex_type> l(s.mutex_);
+    std::unique_lock<mutex_type> rl(ranges_mutex_.data_, std::defer_lock);
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    gva_table_data_type data;
+    bool found = false;
 
-    if (it != end)
+    gva_table_type::iterator it = s.gvas_.find(id);
+    if (it != s.gvas_.end())
     {
         if (HPX_UNLIKELY(it->second.first.count != count))
         {
@@ -593,10 +621,38 @@ naming::address primary_namespace::unbind_gid(
               , "block sizes must match");
         }
 
-        gva_table_data_type data = it->second;
+        data = it->second;
+        s.gvas_.erase(it);
+        found = true;
+    }
+    else if (num_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        rl.lock();
+
+        gva_range_table_type::iterator rit = ranges_.find(id);
+        if (rit != ranges_.end())
+        {
+            if (HPX_UNLIKELY(rit->second.first.count != count))
+            {
+                rl.unlock();
+                l.unlock();
+
+                HPX_THROW_EXCEPTION(bad_parameter
+                  , "primary_namespace::unbind_gid"
+                  , "block sizes must match");
+            }
 
-        gvas_.erase(it);
+            data = rit->second;
+            ranges_.erase(rit);
+            num_ranges_.store(ranges_.size(), std::memory_order_release);
+            found = true;
+        }
 
+        rl.unlock();
+    }
+
+    if (found)
+    {
         l.unlock();
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), gva({3}), "
@@ -611,6 +667,8 @@ naming::address primary_namespace::unbind_gid(
     if (naming::refers_to_local_lva(id) &&
         !naming::refers_to_virtual_memory(id))
     {
+        l.unlock();
+
         naming::gid_type locality = naming::get_locality_from_gid(id);
         gva g(locality,
             naming::detail::get_component_type_from_gid(id.get_msb()),
@@ -655,7 +713,14 @@ std::int64_t primary_namespace::increment_credit(
     // Increment.
     if (credits > 0)
     {
-        increment(lower, upper, credits, hpx::throws);
+        std::vector<refcnt_update> updates;
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        {
+            updates.push_back(
+                refcnt_update{get_shard_index(raw), raw, credits});
+        }
+
+        increment(updates, hpx::throws);
         return 0;
     }
     else
@@ -682,11 +747,16 @@ std::vector<std::int64_t> primary_namespace::decrement_credit(
     std::vector<int64_t> res_credits;
     res_credits.reserve(requests.size());
 
+    // collect the decrements of all requests, they are applied grouped by
+    // shard below
+    std::vector<refcnt_update> updates;
+    updates.reserve(requests.size());
+
     for(auto& req: requests)
     {
         std::int64_t credits = hpx::util::get<0>(req);
         naming::gid_type lower = hpx::util::get<1>(req);
-        naming::gid_type upper = hpx::util::get<1>(req);
+        naming::gid_type upper = hpx::util::get<2>(req);
 
         naming::detail::strip_internal_bits_from_gid(lower);
         naming::detail::strip_internal_bits_from_gid(upper);
@@ -694,23 +764,37 @@ std::vector<std::int64_t> primary_namespace::decrement_credit(
         if (lower == upper)
             ++upper;
 
-        // Decrement.
-        if (credits < 0)
-        {
-            free_entry_list_type free_list;
-            decrement_sweep(free_list, lower, upper, -credits, hpx::throws);
-
-            free_components_sync(free_list, lower, upper, hpx::throws);
-        }
-        else
+        if (credits >= 0)
         {
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::decrement_credit"
               , hpx::util::format("invalid credit count of {1}", credits));
         }
+
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        {
+            updates.push_back(
+                refcnt_update{get_shard_index(raw), raw, -credits});
+        }
+
         res_credits.push_back(credits);
     }
 
+    // Decrement. The objects collected before an invalid update was
+    // encountered are destroyed before the error is reported.
+    free_entry_list_type free_list;
+    try
+    {
+        decrement_sweep(free_list, updates, hpx::throws);
+    }
+    catch (...)
+    {
+        free_components_sync(free_list, hpx::throws);
+        throw;
+    }
+
+    free_components_sync(free_list, hpx::throws);
+
     return res_credits;
 }
 
@@ -780,72 +864,34 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
-      , naming::gid_type const& upper
+        shard& s
+      , naming::gid_type const& id
       , std::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        refcnt_table_type::iterator it = s.refcnts_.find(id);
+        if (it == s.refcnts_.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
-        std::stringstream ss;
-        hpx::util::format_to(ss,
-            "{1}, dumping server-side refcnt table matches, lower({2}), "
-            "upper({3}):",
-            func_name, lower, upper);
-
-        for (/**/; lower_it != upper_it; ++lower_it)
-        {
-            // The [server] tag is in there to make it easier to filter
-            // through the logs.
-            hpx::util::format_to(ss,
-                "\n  [server] lower({1}), credits({2})",
-                lower_it->first,
-                lower_it->second);
-        }
-
-        LAGAS_(debug) << ss.str();
+        // The [server] tag is in there to make it easier to filter through
+        // the logs.
+        LAGAS_(debug) << hpx::util::format(
+            "{1}, dumping server-side refcnt table match:"
+            "\n  [server] id({2}), credits({3})",
+            func_name, it->first, it->second);
     } // dump_refcnt_matches implementation
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::increment(
-    naming::gid_type const& lower
-  , naming::gid_type const& upper
-  , std::int64_t& credits
+    std::vector<refcnt_update>& updates
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    if (LAGAS_ENABLED(debug))
-    {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
-    }
-#endif
 
     // TODO: Whine loudly if a reference count overflows. We reserve ~0 for
     // internal bookkeeping in the decrement algorithm, so the maximum global
@@ -857,39 +903,61 @@ void primary_namespace::increment(
     // allocate/bind them, so if a GID is not in the refcnt table, we know that
     // it's global reference count is the initial global reference count.
 
-    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    // Apply the updates of each shard while holding its lock only once.
+    std::sort(updates.begin(), updates.end());
+
+    std::size_t i = 0;
+    while (i != updates.size())
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
+        std::size_t const shard_index = updates[i].shard_;
+        shard& s = shards_[shard_index].data_;
+
+        std::unique_lock<mutex_type> l(s.mutex_);
+
+        for (/**/; i != updates.size() && updates[i].shard_ == shard_index; ++i)
         {
-            std::int64_t count =
-                std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+            naming::gid_type const& raw = updates[i].id_;
+            std::int64_t const credits = updates[i].credits_;
 
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+            if (LAGAS_ENABLED(debug))
             {
-                l.unlock();
+                dump_refcnt_matches(s, raw, l, "primary_namespace::increment");
+            }
+#endif
 
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::increment"
-                    , hpx::util::format(
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count));
-                return;
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
+            {
+                std::int64_t count =
+                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+
+                std::pair<refcnt_table_type::iterator, bool> p =
+                    s.refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                if (!p.second)
+                {
+                    l.unlock();
+
+                    HPX_THROWS_IF(ec, invalid_data
+                        , "primary_namespace::increment"
+                        , hpx::util::format(
+                            "couldn't create entry in reference count table, "
+                            "raw({1}), ref-count({2})",
+                            raw, count));
+                    return;
+                }
+
+                it = p.first;
+            }
+            else
+            {
+                it->second += credits;
             }
 
-            it = p.first;
-        }
-        else
-        {
-            it->second += credits;
+            LAGAS_(info) << hpx::util::format(
+                "primary_namespace::increment, raw({1}), refcnt({2})",
+                raw, it->second);
         }
-
-        LAGAS_(info) << hpx::util::format(
-            "primary_namespace::increment, raw({1}), refcnt({2})",
-            lower, it->second);
     }
 
     if (&ec != &throws)
@@ -899,26 +967,19 @@ void primary_namespace::increment(
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
     std::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+  , shard& s
+  , std::list<naming::gid_type> const& free_list
   , free_entry_list_type& free_entry_list
-  , naming::gid_type const& lower
-  , naming::gid_type const& upper
   , error_code& ec
     )
 {
     HPX_ASSERT_OWNS_LOCK(l);
+    HPX_ASSERT(l.mutex() == &s.mutex_);
 
     using hpx::util::get;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
-
-        // The mapping's key space.
-        key_type gid = it->first;
-
         if (naming::detail::is_migratable(gid))
         {
             // wait for any migration to be completed
@@ -985,97 +1046,83 @@ void primary_namespace::resolve_free_list(
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
         // remove this entry from the refcnt table
-        refcnts_.erase(it);
+        s.refcnts_.erase(gid);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::decrement_sweep(
     free_entry_list_type& free_entry_list
-  , naming::gid_type const& lower
-  , naming::gid_type const& upper
-  , std::int64_t credits
+  , std::vector<refcnt_update>& updates
   , error_code& ec
     )
 { // {{{ decrement_sweep implementation
-    LAGAS_(info) << hpx::util::format(
-        "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
-        "credits({3})",
-        lower, upper, credits);
-
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
+    // Apply the decrements of each shard while holding its lock only once.
+    std::sort(updates.begin(), updates.end());
 
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
+    std::size_t i = 0;
+    while (i != updates.size())
+    {
+        std::size_t const shard_index = updates[i].shard_;
+        shard& s = shards_[shard_index].data_;
+
+        std::unique_lock<mutex_type> l(s.mutex_);
+
+        // The third parameter we pass here is the default data to use in
+        // case the key is not mapped. We don't insert GIDs into the refcnt
+        // table when we allocate/bind them, so if a GID is not in the refcnt
+        // table, we know that it's global reference count is the initial
+        // global reference count.
+
+        // An invalid update stops the sweep, the objects collected up to
+        // this point are resolved nevertheless (the caller destroys them
+        // before reporting the error).
+        std::list<naming::gid_type> free_list;
+        std::string error_message;
+        for (/**/; i != updates.size() && updates[i].shard_ == shard_index; ++i)
         {
-            typedef refcnt_table_type::iterator iterator;
+            naming::gid_type const& raw = updates[i].id_;
+            std::int64_t const credits = updates[i].credits_;
 
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
+            LAGAS_(info) << hpx::util::format(
+                "primary_namespace::decrement_sweep, raw({1}), credits({2})",
+                raw, credits);
+
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+            if (LAGAS_ENABLED(debug))
             {
-                upper_it = lower_it;
-                ++upper_it;
+                dump_refcnt_matches(
+                    s, raw, l, "primary_namespace::decrement_sweep");
             }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
-
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
-        {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
                 if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                 {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "negative entry in reference count table, raw({1}), "
-                            "refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
-                    return;
+                    error_message = hpx::util::format(
+                        "negative entry in reference count table, raw({1}), "
+                        "refcount({2})",
+                        raw,
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits);
+                    break;
                 }
 
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s.refcnts_.insert(refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count));
-                    return;
+                    error_message = hpx::util::format(
+                        "couldn't create entry in reference count table, "
+                        "raw({1}), ref-count({2})",
+                        raw, count);
+                    break;
                 }
 
                 it = p.first;
@@ -1088,24 +1135,32 @@ void primary_namespace::decrement_sweep(
             // Sanity check.
             if (it->second < 0)
             {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, invalid_data
-                  , "primary_namespace::decrement_sweep"
-                  , hpx::util::format(
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second));
-                return;
+                error_message = hpx::util::format(
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, it->second);
+                break;
             }
 
             // this objects needs to be deleted
             if (it->second == 0)
-                free_list.push_back(it);
+                free_list.push_back(raw);
         }
 
         // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        resolve_free_list(l, s, free_list, free_entry_list, ec);
+        if (ec)
+            return;
+
+        if (!error_message.empty())
+        {
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , error_message);
+            return;
+        }
 
     } // Unlock the mutex.
 
@@ -1116,13 +1171,21 @@ void primary_namespace::decrement_sweep(
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::free_components_sync(
     free_entry_list_type& free_list
-  , naming::gid_type const& lower
-  , naming::gid_type const& upper
   , error_code& ec
     )
 { // {{{ free_components_sync implementation
     using hpx::util::get;
 
+    // components located on other localities are destroyed in bulk, local
+    // components are destroyed at once per component type
+    std::vector<naming::gid_type> remote_gids;
+    std::vector<naming::address> remote_addrs;
+
+    typedef std::pair<
+            std::vector<naming::gid_type>, std::vector<naming::address>
+        > local_components_type;
+    std::map<components::component_type, local_components_type> local;
+
     ///////////////////////////////////////////////////////////////////////////
     // Delete the objects on the free list.
     for (free_entry const& e : free_list)
@@ -1133,19 +1196,15 @@ void primary_namespace::free_components_sync(
         {
             LAGAS_(info) << hpx::util::format(
                 "primary_namespace::free_components_sync, cancelling free "
-                "operation because the threadmanager is down, lower({1}), "
-                "upper({2}), base({3}), gva({4}), locality({5})",
-                lower,
-                upper,
+                "operation because the threadmanager is down, base({1}), "
+                "gva({2}), locality({3})",
                 e.gid_, e.gva_, e.locality_);
             continue;
         }
 
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::free_components_sync, freeing component, "
-            "lower({1}), upper({2}), base({3}), gva({4}), locality({5})",
-            lower,
-            upper,
+            "base({1}), gva({2}), locality({3})",
             e.gid_, e.gva_, e.locality_);
 
         // Destroy the component.
@@ -1162,14 +1221,35 @@ void primary_namespace::free_components_sync(
                         + std::to_string(e.gva_.type));
                 return;
             }
-            deleter(e.gid_, std::move(addr));
+
+            if (components::bulk_deleter(e.gva_.type) == nullptr)
+            {
+                deleter(e.gid_, std::move(addr));
+                continue;
+            }
+
+            local_components_type& l = local[e.gva_.type];
+            l.first.push_back(e.gid_);
+            l.second.push_back(std::move(addr));
         }
         else
         {
-            components::server::destroy_component(e.gid_, addr);
+            remote_gids.push_back(e.gid_);
+            remote_addrs.push_back(std::move(addr));
         }
     }
 
+    for (auto& l : local)
+    {
+        components::bulk_deleter(l.first)(l.second.first, l.second.second);
+    }
+
+    if (!remote_gids.empty())
+    {
+        components::server::destroy_components(
+            std::move(remote_gids), std::move(remote_addrs));
+    }
+
     if (&ec != &throws)
         ec = make_success_code();
 } // }}}
@@ -1197,34 +1277,36 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
+    shard& s = get_shard(id);
+    HPX_ASSERT(l.mutex() == &s.mutex_);
 
-    if (it != end)
+    // Check for exact match
+    gva_table_type::const_iterator it = s.gvas_.find(id);
+    if (it != s.gvas_.end())
     {
-        // Check for exact match
-        if (it->first == id)
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
+        if (&ec != &throws)
+            ec = make_success_code();
 
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
-        }
+        gva_table_data_type const& data = it->second;
+        return resolved_type(it->first, data.first, data.second);
+    }
 
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
+    if (num_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        std::unique_lock<mutex_type> rl(ranges_mutex_.data_);
+
+        gva_range_table_type::const_iterator rit = ranges_.upper_bound(id);
+        if (rit != ranges_.begin())
         {
-            --it;
+            --rit;
 
             // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
+            gva_table_data_type const& data = rit->second;
+            if ((rit->first + data.first.count) > id)
             {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
+                if (HPX_UNLIKELY(id.get_msb() != rit->first.get_msb()))
                 {
+                    rl.unlock();
                     l.unlock();
 
                     HPX_THROWS_IF(ec, internal_server_error
@@ -1237,34 +1319,8 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
                 if (&ec != &throws)
                     ec = make_success_code();
 
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
+                return resolved_type(rit->first, data.first, data.second);
             }
-
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            return resolved_type(it->first, data.first, data.second);
         }
     }
 
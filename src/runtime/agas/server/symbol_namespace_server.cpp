@@ -10,17 +10,22 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/async.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/format.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/local_lcos/promise.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/agas/namespace_action_code.hpp>
 #include <hpx/runtime/agas/server/symbol_namespace.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
 #include <hpx/runtime/naming/split_gid.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/scoped_timer.hpp>
@@ -36,6 +41,7 @@
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -194,6 +200,7 @@ bool symbol_namespace::bind(
     counter_data_.increment_bind_count();
 
     std::unique_lock<mutex_type> l(mutex_);
+    wait_for_invalidation(l, key);
 
     gid_table_type::iterator it = gids_.find(key);
     gid_table_type::iterator end = gids_.end();
@@ -346,7 +353,7 @@ naming::gid_type symbol_namespace::unbind(std::string const& key)
     );
     counter_data_.increment_unbind_count();
 
-    std::lock_guard<mutex_type> l(mutex_);
+    std::unique_lock<mutex_type> l(mutex_);
 
     gid_table_type::iterator it = gids_.find(key);
     gid_table_type::iterator end = gids_.end();
@@ -364,6 +371,26 @@ naming::gid_type symbol_namespace::unbind(std::string const& key)
 
     gids_.erase(it);
 
+    // binding the name anew waits for the cached entries to be gone, the
+    // pending invalidation is recorded before the lock is released
+    std::set<std::uint32_t> subscribers;
+    std::shared_ptr<lcos::local::promise<void> > invalidated;
+    cache_subscribers_type::iterator sit = cache_subscribers_.find(key);
+    if (sit != cache_subscribers_.end())
+    {
+        subscribers.swap(sit->second.localities_);
+        cache_subscription_order_.erase(sit->second.order_);
+        cache_subscribers_.erase(sit);
+
+        if (!subscribers.empty())
+            invalidated = add_pending_invalidation(key);
+    }
+
+    l.unlock();
+
+    if (invalidated)
+        invalidate_caches(key, subscribers, std::move(invalidated));
+
     LAGAS_(info) << hpx::util::format(
         "symbol_namespace::unbind, key({1}), gid({2})",
         key, gid);
@@ -371,6 +398,102 @@ naming::gid_type symbol_namespace::unbind(std::string const& key)
     return gid;
 } // }}}
 
+std::shared_ptr<lcos::local::promise<void> >
+symbol_namespace::add_pending_invalidation(
+    std::string const& key
+    )
+{
+    std::shared_ptr<lcos::local::promise<void> > done =
+        std::make_shared<lcos::local::promise<void> >();
+
+    // earlier invalidations of the same name are kept, binding the name
+    // waits for all of them
+    pending_invalidations_.emplace(key, done->get_future().share());
+    return done;
+}
+
+void symbol_namespace::invalidate_caches(
+    std::string const& key
+  , std::set<std::uint32_t> const& localities
+  , std::shared_ptr<lcos::local::promise<void> > done
+    )
+{
+    std::uint32_t const here = hpx::get_locality_id();
+
+    std::vector<hpx::future<void> > lazy_results;
+    for (std::uint32_t locality_id : localities)
+    {
+        if (locality_id == here)
+        {
+            invalidate(key);
+            continue;
+        }
+
+        naming::id_type target(
+            naming::replace_locality_id(
+                bootstrap_symbol_namespace_gid(), locality_id)
+          , naming::id_type::unmanaged);
+
+        lazy_results.push_back(
+            hpx::async(invalidate_action(), std::move(target), key));
+    }
+
+    // a failed invalidation (i.e. a locality having exited already) does not
+    // affect the name, the entries are removed once all requests have
+    // returned
+    auto on_invalidated =
+        [this, key, done]()
+        {
+            done->set_value();
+
+            std::lock_guard<mutex_type> l(mutex_);
+            auto range = pending_invalidations_.equal_range(key);
+            for (auto it = range.first; it != range.second; /**/)
+            {
+                if (it->second.is_ready())
+                    it = pending_invalidations_.erase(it);
+                else
+                    ++it;
+            }
+        };
+
+    if (lazy_results.empty())
+    {
+        on_invalidated();
+        return;
+    }
+
+    hpx::when_all(std::move(lazy_results)).then(hpx::launch::sync,
+        [on_invalidated](hpx::future<std::vector<hpx::future<void> > >&&)
+        {
+            on_invalidated();
+        });
+}
+
+void symbol_namespace::wait_for_invalidation(
+    std::unique_lock<mutex_type>& l
+  , std::string const& key
+    )
+{
+    HPX_ASSERT(l.owns_lock());
+
+    pending_invalidations_type::iterator it = pending_invalidations_.find(key);
+    while (it != pending_invalidations_.end())
+    {
+        if (it->second.is_ready())
+        {
+            pending_invalidations_.erase(it);
+        }
+        else
+        {
+            hpx::shared_future<void> f = it->second;
+            util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+            f.wait();
+        }
+        it = pending_invalidations_.find(key);
+    }
+}
+
 // TODO: catch exceptions
 symbol_namespace::iterate_names_return_type symbol_namespace::iterate(
     std::string const& pattern)
@@ -482,6 +605,99 @@ bool symbol_namespace::on_event(
     return true;
 } // }}}
 
+std::vector<naming::gid_type> symbol_namespace::on_events(
+    std::vector<std::string> const& names
+  , std::vector<hpx::id_type> const& lcos
+    )
+{ // {{{ on_events implementation
+    util::scoped_timer<std::atomic<std::int64_t> > update(
+        counter_data_.on_event_.time_,
+        counter_data_.on_event_.enabled_
+    );
+    counter_data_.increment_on_event_count();
+
+    if (HPX_UNLIKELY(names.size() != lcos.size()))
+    {
+        HPX_THROW_EXCEPTION(bad_parameter
+          , "symbol_namespace::on_events"
+          , hpx::util::format("mismatching number of names ({1}) and "
+                "LCOs ({2})", names.size(), lcos.size()));
+    }
+
+    std::vector<naming::gid_type> result(names.size());
+    std::vector<evicted_subscription> evicted;
+
+    std::unique_lock<mutex_type> l(mutex_);
+    for (std::size_t i = 0; i != names.size(); ++i)
+    {
+        // the requesting locality may cache the id bound to the name
+        cache_subscribers_type::iterator sit =
+            cache_subscribers_.find(names[i]);
+        if (sit == cache_subscribers_.end())
+        {
+            if (cache_subscribers_.size() >=
+                HPX_AGAS_MAX_SYMBOL_CACHE_SUBSCRIPTIONS)
+            {
+                // make room by invalidating the oldest subscription
+                cache_subscribers_type::iterator oldest =
+                    cache_subscribers_.find(cache_subscription_order_.front());
+                HPX_ASSERT(oldest != cache_subscribers_.end());
+
+                if (!oldest->second.localities_.empty())
+                {
+                    evicted.push_back(evicted_subscription{oldest->first,
+                        std::move(oldest->second.localities_),
+                        add_pending_invalidation(oldest->first)});
+                }
+                cache_subscription_order_.pop_front();
+                cache_subscribers_.erase(oldest);
+            }
+
+            sit = cache_subscribers_.emplace(
+                names[i], cache_subscription()).first;
+            sit->second.order_ = cache_subscription_order_.insert(
+                cache_subscription_order_.end(), names[i]);
+        }
+        sit->second.localities_.insert(
+            naming::get_locality_id_from_id(lcos[i]));
+
+        gid_table_type::iterator it = gids_.find(names[i]);
+        if (it == gids_.end())
+        {
+            // trigger the LCO as soon as the name is bound
+            on_event_data_.insert(
+                on_event_data_map_type::value_type(names[i], lcos[i]));
+            continue;
+        }
+
+        // hold on to entry while map is unlocked
+        std::shared_ptr<naming::gid_type> current_gid(it->second);
+
+        // split the credit as the receiving end will expect to keep the
+        // object alive
+        util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+        result[i] =
+            naming::detail::split_gid_if_needed(*current_gid).get();
+    }
+    l.unlock();
+
+    for (auto& e : evicted)
+        invalidate_caches(e.key_, e.localities_, std::move(e.done_));
+
+    LAGAS_(info) << hpx::util::format(
+        "symbol_namespace::on_events, names({1})", names.size());
+
+    return result;
+} // }}}
+
+void symbol_namespace::invalidate(std::string const& key)
+{
+    naming::get_agas_client().invalidate_symbol_cache(key);
+
+    LAGAS_(info) << hpx::util::format(
+        "symbol_namespace::invalidate, key({1})", key);
+}
+
 naming::gid_type symbol_namespace::statistics_counter(std::string const& name)
 { // {{{ statistics_counter implementation
     LAGAS_(info) << "symbol_namespace::statistics_counter";
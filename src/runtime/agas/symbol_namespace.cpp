@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
 #include <hpx/async.hpp>
 #include <hpx/collectives.hpp>
 #include <hpx/format.hpp>
@@ -58,6 +59,16 @@ HPX_REGISTER_ACTION_ID(
     symbol_namespace_on_event_action,
     hpx::actions::symbol_namespace_on_event_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    symbol_namespace::on_events_action,
+    symbol_namespace_on_events_action,
+    hpx::actions::symbol_namespace_on_events_action_id)
+
+HPX_REGISTER_ACTION_ID(
+    symbol_namespace::invalidate_action,
+    symbol_namespace_invalidate_action,
+    hpx::actions::symbol_namespace_invalidate_action_id)
+
 HPX_REGISTER_ACTION_ID(
     symbol_namespace::statistics_counter_action,
     symbol_namespace_statistics_counter_action,
@@ -219,6 +230,35 @@ namespace hpx { namespace agas
         return hpx::async(
             action, std::move(dest), name, call_for_past_events, std::move(lco));
     }
+
+    hpx::future<std::vector<naming::id_type> > symbol_namespace::on_events(
+        std::vector<std::string> names
+      , std::vector<hpx::id_type> lcos
+        )
+    {
+        HPX_ASSERT(!names.empty());
+
+        naming::id_type dest = symbol_namespace_locality(names.front());
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            std::vector<naming::gid_type> raw_gids =
+                server_->on_events(names, lcos);
+
+            std::vector<naming::id_type> ids;
+            ids.reserve(raw_gids.size());
+            for (naming::gid_type const& raw_gid : raw_gids)
+            {
+                ids.push_back(naming::id_type(raw_gid,
+                    naming::detail::has_credits(raw_gid) ?
+                        naming::id_type::managed :
+                        naming::id_type::unmanaged));
+            }
+            return hpx::make_ready_future(std::move(ids));
+        }
+        server::symbol_namespace::on_events_action action;
+        return hpx::async(
+            action, std::move(dest), std::move(names), std::move(lcos));
+    }
 }}
 
 typedef symbol_namespace::iterate_action iterate_action;
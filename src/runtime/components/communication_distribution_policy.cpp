@@ -0,0 +1,231 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/assertion.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/logging.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/components/binpacking_distribution_policy.hpp>
+#include <hpx/runtime/components/communication_distribution_policy.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        // the counter values of all localities, or zeros if the counters
+        // are not available
+        std::vector<std::uint64_t> get_values_or_zero(
+            hpx::future<std::vector<std::uint64_t>>&& f,
+            std::string const& counter_name, std::size_t size)
+        {
+            if (f.has_exception())
+            {
+                LRT_(warning) << "communication_distribution_policy: "
+                                 "the counters "
+                              << counter_name
+                              << " are not available, the traffic of the "
+                                 "action is not taken into account";
+                return std::vector<std::uint64_t>(size, 0);
+            }
+            return f.get();
+        }
+
+        // The counter values observed by the previous placement, the
+        // placements are based on the difference to those.
+        struct traffic_samples
+        {
+            typedef lcos::local::spinlock mutex_type;
+            typedef std::pair<std::string, std::uint32_t> key_type;
+
+            std::vector<std::uint64_t> get_delta(
+                std::string const& counter_name,
+                std::vector<hpx::id_type> const& localities,
+                std::vector<std::uint64_t> values)
+            {
+                HPX_ASSERT(localities.size() == values.size());
+
+                std::lock_guard<mutex_type> l(mtx_);
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    std::uint64_t& last = last_[key_type(counter_name,
+                        naming::get_locality_id_from_id(localities[i]))];
+
+                    std::uint64_t const value = values[i];
+
+                    // the counter may have been reset in between
+                    if (value >= last)
+                        values[i] -= last;
+                    last = value;
+                }
+                return values;
+            }
+
+            mutex_type mtx_;
+            std::map<key_type, std::uint64_t> last_;
+        };
+
+        traffic_samples& get_traffic_samples()
+        {
+            static traffic_samples samples;
+            return samples;
+        }
+
+        std::string get_parcelport_name(std::string const& parcelport)
+        {
+            if (!parcelport.empty())
+                return parcelport;
+
+            // use the parcelport parcels are sent with
+            std::shared_ptr<parcelset::parcelport> pp =
+                get_runtime().get_parcel_handler().get_default_parcelport();
+            return pp ? pp->type() : std::string("tcp");
+        }
+    }
+
+    hpx::future<std::vector<std::uint64_t>> get_communication_costs(
+        std::string const& action_name, std::string const& parcelport,
+        std::uint64_t parcel_cost, std::vector<hpx::id_type> const& localities)
+    {
+        std::string const pp = get_parcelport_name(parcelport);
+
+        // the locality of the instance names is filled in by
+        // get_counter_values, the amount of data sent is taken from the
+        // serialization counters as /data/count is not available per action
+        std::string bytes_name =
+            "/serialize{locality/total}/count/" + pp + "/sent@";
+        std::string parcels_name =
+            "/parcels{locality/total}/count/" + pp + "/sent@";
+
+        hpx::future<std::vector<std::uint64_t>> bytes =
+            get_counter_values(action_name, bytes_name, localities);
+        hpx::future<std::vector<std::uint64_t>> parcels =
+            get_counter_values(action_name, parcels_name, localities);
+
+        bytes_name += action_name;
+        parcels_name += action_name;
+
+        return hpx::dataflow(hpx::launch::sync,
+            [localities, parcel_cost, bytes_name = std::move(bytes_name),
+                parcels_name = std::move(parcels_name)](
+                hpx::future<std::vector<std::uint64_t>>&& bytes_f,
+                hpx::future<std::vector<std::uint64_t>>&& parcels_f)
+                -> std::vector<std::uint64_t>
+            {
+                std::size_t const size = localities.size();
+                traffic_samples& samples = get_traffic_samples();
+
+                // only the traffic since the previous placement is used
+                std::vector<std::uint64_t> costs = samples.get_delta(
+                    bytes_name, localities,
+                    get_values_or_zero(std::move(bytes_f), bytes_name, size));
+                std::vector<std::uint64_t> parcels = samples.get_delta(
+                    parcels_name, localities,
+                    get_values_or_zero(
+                        std::move(parcels_f), parcels_name, size));
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    costs[i] += parcels[i] * parcel_cost;
+                }
+                return costs;
+            },
+            std::move(bytes), std::move(parcels));
+    }
+
+    std::size_t get_communication_partner(
+        std::vector<std::uint64_t> const& costs,
+        std::vector<std::uint64_t> const& instances)
+    {
+        HPX_ASSERT(costs.size() == instances.size());
+
+        // prefer the locality generating the most traffic, break ties using
+        // the number of existing instances
+        std::size_t best_locality = 0;
+        for (std::size_t i = 1; i != costs.size(); ++i)
+        {
+            if (costs[i] > costs[best_locality] ||
+                (costs[i] == costs[best_locality] &&
+                    instances[i] < instances[best_locality]))
+            {
+                best_locality = i;
+            }
+        }
+        return best_locality;
+    }
+
+    std::vector<std::size_t> get_communication_items_count(
+        std::size_t count, std::vector<std::uint64_t> const& costs,
+        std::vector<std::uint64_t> const& instances)
+    {
+        HPX_ASSERT(costs.size() == instances.size());
+
+        // fall back to balancing the number of instances if no traffic was
+        // recorded
+        long double total = 0;
+        for (std::uint64_t cost : costs)
+            total += cost;
+
+        if (total == 0)
+            return get_items_count(count, instances);
+
+        // distribute the objects proportionally to the traffic, the
+        // remaining objects are assigned to the localities generating the
+        // most traffic
+        std::size_t const num_localities = costs.size();
+        std::vector<std::size_t> to_create(num_localities, 0);
+
+        std::size_t assigned = 0;
+        for (std::size_t i = 0; i != num_localities; ++i)
+        {
+            to_create[i] = static_cast<std::size_t>(count * (costs[i] / total));
+            assigned += to_create[i];
+        }
+
+        HPX_ASSERT(assigned <= count);
+        if (assigned != count)
+        {
+            to_create[get_communication_partner(costs, instances)] +=
+                count - assigned;
+        }
+
+        return to_create;
+    }
+
+    hpx::future<hpx::id_type> get_communication_target(
+        std::string const& component_name, std::string const& action_name,
+        std::string const& parcelport, std::uint64_t parcel_cost,
+        std::vector<hpx::id_type> const& localities)
+    {
+        hpx::future<std::vector<std::uint64_t>> costs =
+            get_communication_costs(
+                action_name, parcelport, parcel_cost, localities);
+        hpx::future<std::vector<std::uint64_t>> instances =
+            get_counter_values(component_name,
+                default_binpacking_counter_name, localities);
+
+        return hpx::dataflow(hpx::launch::sync,
+            [localities](hpx::future<std::vector<std::uint64_t>>&& costs,
+                hpx::future<std::vector<std::uint64_t>>&& instances)
+                -> hpx::id_type
+            {
+                return localities[get_communication_partner(
+                    costs.get(), instances.get())];
+            },
+            std::move(costs), std::move(instances));
+    }
+}}}    // namespace hpx::components::detail
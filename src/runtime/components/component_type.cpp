@@ -35,6 +35,7 @@ namespace hpx { namespace components
                   : enabled_(false)
                   , instance_count_(0)
                   , deleter_(nullptr)
+                  , bulk_deleter_(nullptr)
                 {}
 
                 // note, this done to be able to put the entry into the map.
@@ -44,11 +45,13 @@ namespace hpx { namespace components
                   : enabled_(false)
                   , instance_count_(0)
                   , deleter_(nullptr)
+                  , bulk_deleter_(nullptr)
                 {}
 
                 bool enabled_;
                 util::atomic_count instance_count_;
                 component_deleter_type deleter_;
+                component_bulk_deleter_type bulk_deleter_;
             };
 
         private:
@@ -124,6 +127,11 @@ namespace hpx { namespace components
         return detail::component_database::get_entry(type).deleter_;
     }
 
+    component_bulk_deleter_type& bulk_deleter(component_type type)
+    {
+        return detail::component_database::get_entry(type).bulk_deleter_;
+    }
+
     bool enumerate_instance_counts(
         util::unique_function_nonser<bool(component_type)> const& f)
     {
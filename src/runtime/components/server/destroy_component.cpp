@@ -5,18 +5,27 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
 #include <hpx/async.hpp>
+#include <hpx/lcos/wait_all.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/components/server/destroy_component.hpp>
 #include <hpx/runtime/naming/name.hpp>
+#include <hpx/serialization/vector.hpp>
 
 #include <hpx/logging.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
 
 HPX_PLAIN_ACTION_ID(hpx::components::server::destroy_component,
     hpx_destroy_component_action, hpx::actions::free_component_action_id);
+HPX_PLAIN_ACTION_ID(hpx::components::server::destroy_components,
+    hpx_destroy_components_action, hpx::actions::free_components_action_id);
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace components { namespace server
@@ -60,5 +69,75 @@ namespace hpx { namespace components { namespace server
 
         hpx_destroy_component_action()(id, gid, addr);
     }
-}}}
 
+    ///////////////////////////////////////////////////////////////////////////
+    void destroy_components(std::vector<naming::gid_type> gids,
+        std::vector<naming::address> addrs)
+    {
+        HPX_ASSERT(gids.size() == addrs.size());
+
+        typedef std::pair<
+                std::vector<naming::gid_type>, std::vector<naming::address>
+            > components_type;
+        std::map<naming::gid_type, components_type> remote;
+        std::map<components::component_type, components_type> local;
+
+        naming::gid_type const here = hpx::get_locality();
+        for (std::size_t i = 0; i != gids.size(); ++i)
+        {
+            naming::address& addr = addrs[i];
+            if (addr.locality_ == here ||
+                agas::is_local_address_cached(gids[i], addr))
+            {
+                // migrated objects and virtual memory are handled by
+                // destroy_component
+                if (naming::refers_to_virtual_memory(gids[i]) ||
+                    bulk_deleter(addr.type_) == nullptr ||
+                    agas::was_object_migrated(
+                        gids[i], []() { return pinned_ptr(); }).first)
+                {
+                    destroy_component(gids[i], addr);
+                    continue;
+                }
+
+                components_type& l = local[addr.type_];
+                l.first.push_back(gids[i]);
+                l.second.push_back(std::move(addr));
+                continue;
+            }
+
+            components_type& r = remote[addr.locality_];
+            r.first.push_back(gids[i]);
+            r.second.push_back(std::move(addr));
+        }
+
+        // destroy the local components of each type at once
+        for (auto& l : local)
+        {
+            bulk_deleter(l.first)(l.second.first, l.second.second);
+
+            LRT_(info) << "successfully destroyed " << l.second.first.size()
+                << " components of type: "
+                << components::get_component_type_name(l.first);
+        }
+
+        if (remote.empty())
+            return;
+
+        // send all components located on the same locality at once
+        std::vector<hpx::future<void>> requests;
+        requests.reserve(remote.size());
+        for (auto& r : remote)
+        {
+            naming::id_type id(r.first, naming::id_type::unmanaged);
+            requests.push_back(hpx::async(hpx_destroy_components_action(), id,
+                std::move(r.second.first), std::move(r.second.second)));
+        }
+
+        hpx::wait_all(requests);
+        for (hpx::future<void>& f : requests)
+        {
+            f.get();    // rethrow exceptions
+        }
+    }
+}}}
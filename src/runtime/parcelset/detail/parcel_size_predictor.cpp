@@ -0,0 +1,163 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/actions/base_action.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_size_predictor.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    namespace
+    {
+        // exponential moving average, new samples have a weight of 1/8
+        std::size_t update_average(std::size_t average, std::size_t sample)
+        {
+            if (sample >= average)
+                return average + (sample - average + 7) / 8;
+            return average - (average - sample) / 8;
+        }
+
+        std::size_t hash_action(char const* action, std::size_t size)
+        {
+            std::uint64_t h = reinterpret_cast<std::uintptr_t>(action);
+            h = (h >> 3) * 0x9e3779b97f4a7c15ull;
+            return static_cast<std::size_t>(h >> 32) % size;
+        }
+    }
+
+    constexpr std::size_t parcel_size_predictor::num_entries;
+
+    parcel_size_predictor::parcel_size_predictor()
+      : entries_(new entry[num_entries]())
+      , mispredictions_(0)
+    {
+    }
+
+    parcel_size_predictor::entry const* parcel_size_predictor::find(
+        char const* action) const
+    {
+        std::size_t const start = hash_action(action, num_entries);
+        for (std::size_t i = 0; i != num_entries; ++i)
+        {
+            entry const& e = entries_[(start + i) % num_entries];
+
+            char const* key = e.action_.load(std::memory_order_acquire);
+            if (key == action)
+                return &e;
+            if (key == nullptr)
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+    parcel_size_predictor::entry* parcel_size_predictor::find_or_insert(
+        char const* action, bool& inserted)
+    {
+        inserted = false;
+
+        std::size_t const start = hash_action(action, num_entries);
+        for (std::size_t i = 0; i != num_entries; ++i)
+        {
+            entry& e = entries_[(start + i) % num_entries];
+
+            char const* key = e.action_.load(std::memory_order_acquire);
+            if (key == nullptr &&
+                e.action_.compare_exchange_strong(key, action,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                inserted = true;
+                return &e;
+            }
+            if (key == action)
+                return &e;
+        }
+        return nullptr;
+    }
+
+    parcel_size_predictor::estimate parcel_size_predictor::predict(
+        parcel const& p) const
+    {
+        // the size gathered while preprocessing the parcel covers all data,
+        // regardless of whether it will be sent as a zero-copy chunk
+        actions::base_action* act = p.get_action();
+        if (act == nullptr)
+        {
+            estimate result = {p.size(), 0, p.num_chunks()};
+            return result;
+        }
+
+        return predict(act->get_action_name(), p.size(), p.num_chunks());
+    }
+
+    parcel_size_predictor::estimate parcel_size_predictor::predict(
+        char const* action, std::size_t size, std::size_t num_chunks) const
+    {
+        estimate result = {size, 0, num_chunks};
+
+        entry const* e = find(action);
+        if (e == nullptr)
+            return result;
+
+        // an entry which is just being inserted may still report zero sizes,
+        // which only causes the buffers to grow as usual
+        result.zero_copy_bytes_ =
+            e->zero_copy_bytes_.load(std::memory_order_relaxed);
+        result.num_chunks_ = e->num_chunks_.load(std::memory_order_relaxed);
+
+        if (size == 0)
+        {
+            result.inline_bytes_ =
+                e->inline_bytes_.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            result.zero_copy_bytes_ = (std::min)(result.zero_copy_bytes_, size);
+            result.inline_bytes_ = size - result.zero_copy_bytes_;
+        }
+        return result;
+    }
+
+    void parcel_size_predictor::update(
+        char const* action, estimate const& actual)
+    {
+        bool inserted = false;
+        entry* e = find_or_insert(action, inserted);
+        if (e == nullptr)
+            return;
+
+        // the first sample of an action is taken as is, concurrent updates
+        // of the same action may lose samples, which is acceptable for an
+        // estimate
+        auto update = [inserted](std::atomic<std::size_t>& average,
+                          std::size_t sample) {
+            if (!inserted)
+            {
+                sample = update_average(
+                    average.load(std::memory_order_relaxed), sample);
+            }
+            average.store(sample, std::memory_order_relaxed);
+        };
+
+        update(e->inline_bytes_, actual.inline_bytes_);
+        update(e->zero_copy_bytes_, actual.zero_copy_bytes_);
+        update(e->num_chunks_, actual.num_chunks_);
+    }
+
+    std::int64_t parcel_size_predictor::get_mispredictions(bool reset)
+    {
+        return reset ? mispredictions_.exchange(0) : mispredictions_.load();
+    }
+}}}
+
+#endif
@@ -148,6 +148,16 @@ namespace hpx { namespace parcelset
         return std::shared_ptr<parcelport>();
     }
 
+    std::shared_ptr<parcelport> parcelhandler::get_default_parcelport() const
+    {
+        // the parcelports are ordered by decreasing priority
+        for (pports_type::value_type const& pp : pports_)
+        {
+            if (pp.first > 0)
+                return pp.second;
+        }
+        return std::shared_ptr<parcelport>();
+    }
 
     void parcelhandler::initialize(naming::resolver_client &resolver,
         applier::applier *applier)
@@ -976,6 +986,58 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    // per-lane queueing delay of outgoing parcels
+    std::int64_t parcelhandler::get_queueing_time(std::string const& pp_type,
+        parcelport::parcel_lane lane, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queueing_time(lane, reset) : 0;
+    }
+    std::int64_t parcelhandler::get_queueing_count(std::string const& pp_type,
+        parcelport::parcel_lane lane, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queueing_count(lane, reset) : 0;
+    }
+
+    // number of messages not fitting the predicted send buffer sizes
+    std::int64_t parcelhandler::get_size_mispredictions(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_size_mispredictions(reset) : 0;
+    }
+
+    // number of bytes of received messages verified against their checksums
+    std::int64_t parcelhandler::get_checksum_bytes_verified(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_checksum_bytes_verified(reset) : 0;
+    }
+
+    // number of received messages failing the checksum verification
+    std::int64_t parcelhandler::get_checksum_failures(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_checksum_failures(reset) : 0;
+    }
+
+    // number of messages sent striped over several connections
+    std::int64_t parcelhandler::get_striped_message_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_striped_message_count(reset) : 0;
+    }
+
     // connection stack statistics
     std::int64_t parcelhandler::get_connection_cache_statistics(
         std::string const& pp_type,
@@ -986,6 +1048,16 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // send buffer pool statistics
+    std::int64_t parcelhandler::get_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::buffer_pool_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1198,6 +1270,37 @@ namespace hpx { namespace parcelset
             util::bind_front(&parcelhandler::get_buffer_allocate_time_received, this,
                 pp_type));
 
+        util::function_nonser<std::int64_t(bool)> queueing_time_normal(
+            util::bind_front(&parcelhandler::get_queueing_time, this,
+                pp_type, parcelport::parcel_lane_normal));
+        util::function_nonser<std::int64_t(bool)> queueing_time_priority(
+            util::bind_front(&parcelhandler::get_queueing_time, this,
+                pp_type, parcelport::parcel_lane_priority));
+        util::function_nonser<std::int64_t(bool)> queueing_count_normal(
+            util::bind_front(&parcelhandler::get_queueing_count, this,
+                pp_type, parcelport::parcel_lane_normal));
+        util::function_nonser<std::int64_t(bool)> queueing_count_priority(
+            util::bind_front(&parcelhandler::get_queueing_count, this,
+                pp_type, parcelport::parcel_lane_priority));
+        util::function_nonser<std::int64_t(bool)> size_mispredictions(
+            util::bind_front(&parcelhandler::get_size_mispredictions, this,
+                pp_type));
+        util::function_nonser<std::int64_t(bool)> checksum_bytes_verified(
+            util::bind_front(&parcelhandler::get_checksum_bytes_verified,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> checksum_failures(
+            util::bind_front(&parcelhandler::get_checksum_failures, this,
+                pp_type));
+        util::function_nonser<std::int64_t(bool)> striped_messages(
+            util::bind_front(&parcelhandler::get_striped_message_count, this,
+                pp_type));
+        util::function_nonser<std::int64_t(bool)> buffer_pool_hits(
+            util::bind_front(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelset::buffer_pool_hits));
+        util::function_nonser<std::int64_t(bool)> buffer_pool_misses(
+            util::bind_front(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelset::buffer_pool_misses));
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -1418,6 +1521,136 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format(
+                "/parcelqueue/time/{}/normal", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the total time outgoing parcels were waiting in "
+                  "the normal lane before being sent using the {} "
+                  "connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(queueing_time_normal), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { hpx::util::format(
+                "/parcelqueue/count/{}/normal", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of times outgoing parcels were taken "
+                  "from the normal lane for sending using the {} "
+                  "connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(queueing_count_normal), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/parcelqueue/time/{}/priority", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the total time outgoing parcels were waiting in "
+                  "the priority lane before being sent using the {} "
+                  "connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(queueing_time_priority), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { hpx::util::format(
+                "/parcelqueue/count/{}/priority", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of times outgoing parcels were taken "
+                  "from the priority lane for sending using the {} "
+                  "connection type", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(queueing_count_priority), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/parcels/count/{}/size-mispredictions", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of messages sent using the {} "
+                  "connection type which did not fit the predicted size of "
+                  "their send buffers", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(size_mispredictions), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/data/count/{}/checksum-verified", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the amount of data received using the {} "
+                  "connection type which was verified against its "
+                  "checksum", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(checksum_bytes_verified), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { hpx::util::format(
+                "/parcels/count/{}/checksum-failures", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of messages received using the {} "
+                  "connection type which failed the verification of their "
+                  "checksum", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(checksum_failures), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/parcels/count/{}/striped", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of messages sent using the {} "
+                  "connection type whose zero-copy data was striped over "
+                  "several connections", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(striped_messages), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/parcels/count/{}/buffer-pool-hits", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of send buffers for the {} "
+                  "connection type which were taken from the pool of "
+                  "recycled buffers", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(buffer_pool_hits), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                "/parcels/count/{}/buffer-pool-misses", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of send buffers for the {} "
+                  "connection type which had to be newly allocated because "
+                  "the pool of recycled buffers had no suitable one", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(buffer_pool_misses), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -1601,6 +1834,10 @@ namespace hpx { namespace parcelset
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.array_optimization]}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
+            "checksums = ${HPX_PARCEL_CHECKSUMS:0}",
+            "buffer_pool_max_cached = ${HPX_PARCEL_BUFFER_POOL_MAX_CACHED:16}",
+            "buffer_pool_max_buffer_size = "
+                "${HPX_PARCEL_BUFFER_POOL_MAX_BUFFER_SIZE:16777216}",
 #if defined(HPX_HAVE_PARCEL_COALESCING)
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}"
 #else
@@ -42,6 +42,7 @@ namespace hpx { namespace parcelset
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
+        enable_checksums_(false),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
         type_(type)
@@ -69,6 +70,20 @@ namespace hpx { namespace parcelset
         {
             async_serialization_ = true;
         }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".checksums", 0) != 0)
+        {
+            enable_checksums_ = true;
+        }
+        checksum_bytes_verified_.store(0);
+        checksum_failures_.store(0);
+        striped_messages_.store(0);
+
+        for (std::size_t i = 0; i != num_parcel_lanes; ++i)
+        {
+            queueing_time_[i].store(0);
+            queueing_count_[i].store(0);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -190,16 +205,73 @@ namespace hpx { namespace parcelset
     {
         std::lock_guard<lcos::local::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
+        for (auto && lane : pending_parcels_)
         {
-            count += hpx::util::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::util::get<0>(p.second).size() ==
-                hpx::util::get<1>(p.second).size());
+            for (auto && p : lane)
+            {
+                count += hpx::util::get<0>(p.second).size();
+                HPX_ASSERT(
+                    hpx::util::get<0>(p.second).size() ==
+                    hpx::util::get<1>(p.second).size());
+            }
         }
         return count;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    parcelport::parcel_lane parcelport::get_parcel_lane(parcel const& p)
+    {
+        switch (p.get_thread_priority())
+        {
+        case threads::thread_priority_high_recursive:
+        case threads::thread_priority_boost:
+        case threads::thread_priority_high:
+        case threads::thread_priority_bound:
+            return parcel_lane_priority;
+
+        default:
+            break;
+        }
+        return parcel_lane_normal;
+    }
+
+    std::int64_t parcelport::get_queueing_time(parcel_lane lane, bool reset)
+    {
+        HPX_ASSERT(lane < num_parcel_lanes);
+        return reset ? queueing_time_[lane].exchange(0) :
+            queueing_time_[lane].load();
+    }
+
+    std::int64_t parcelport::get_queueing_count(parcel_lane lane, bool reset)
+    {
+        HPX_ASSERT(lane < num_parcel_lanes);
+        return reset ? queueing_count_[lane].exchange(0) :
+            queueing_count_[lane].load();
+    }
+
+    std::int64_t parcelport::get_size_mispredictions(bool reset)
+    {
+        return size_predictor_.get_mispredictions(reset);
+    }
+
+    std::int64_t parcelport::get_checksum_bytes_verified(bool reset)
+    {
+        return reset ? checksum_bytes_verified_.exchange(0) :
+            checksum_bytes_verified_.load();
+    }
+
+    std::int64_t parcelport::get_checksum_failures(bool reset)
+    {
+        return reset ? checksum_failures_.exchange(0) :
+            checksum_failures_.load();
+    }
+
+    std::int64_t parcelport::get_striped_message_count(bool reset)
+    {
+        return reset ? striped_messages_.exchange(0) :
+            striped_messages_.load();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
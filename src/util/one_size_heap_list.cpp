@@ -20,11 +20,15 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace hpx { namespace util
 {
@@ -209,6 +213,75 @@ namespace hpx { namespace util
                 p, name()));
     }
 
+    void one_size_heap_list::free_bulk(std::vector<void*> ptrs)
+    {
+        if (ptrs.empty() || !threads::threadmanager_is(state_running))
+            return;
+
+        // if this is called from outside a HPX thread we need to
+        // re-schedule the request
+        if (nullptr == threads::get_self_ptr())
+        {
+            hpx::threads::register_work_nullary(
+                util::bind_front(
+                    &one_size_heap_list::free_bulk, this, std::move(ptrs)),
+                "one_size_heap_list::free_bulk");
+            return;
+        }
+
+        std::sort(ptrs.begin(), ptrs.end(), std::less<void*>());
+
+        unique_lock_type ul(mtx_);
+
+        std::size_t i = 0;
+        while (i != ptrs.size())
+        {
+            // Find the heap which allocated this pointer.
+            std::shared_ptr<util::wrapper_heap_base> heap;
+            for (auto& h : heap_list_)
+            {
+                if (h->did_alloc(ptrs[i]))
+                {
+                    heap = h;
+                    break;
+                }
+            }
+
+            if (!heap)
+            {
+                ul.unlock();
+
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    name() + "::free_bulk",
+                    hpx::util::format(
+                        "pointer {1} was not allocated by this {2}",
+                        ptrs[i], name()));
+            }
+
+            // the following objects which occupy the adjacent slots of the
+            // same heap are released along with this one
+            char* const first = static_cast<char*>(ptrs[i]);
+            std::size_t count = 1;
+            while (i + count != ptrs.size() &&
+                static_cast<char*>(ptrs[i + count]) ==
+                    first + count * parameters_.element_size &&
+                heap->did_alloc(ptrs[i + count]))
+            {
+                ++count;
+            }
+
+            {
+                util::unlock_guard<unique_lock_type> ull(ul);
+                heap->free(first, count);
+            }
+
+#if defined(HPX_DEBUG)
+            free_count_ += count;
+#endif
+            i += count;
+        }
+    }
+
     bool one_size_heap_list::did_alloc(void* p) const
     {
         unique_lock_type ul(mtx_);
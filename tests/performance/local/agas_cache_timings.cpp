@@ -12,10 +12,8 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
-#include <hpx/cache/entries/lfu_entry.hpp>
-#include <hpx/cache/local_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/testing.hpp>
 
@@ -26,101 +24,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
-#include <map>
 #include <string>
-#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
-// Below is a copy of the original AGAS cache
-typedef hpx::util::cache::entries::lfu_entry<hpx::agas::gva> gva_entry_type;
-
-struct gva_cache_key
-{
-private:
-    typedef std::pair<hpx::naming::gid_type, hpx::naming::gid_type> key_type;
-
-    key_type key_;
-
-public:
-    gva_cache_key()
-      : key_()
-    {
-    }
-
-    explicit gva_cache_key(
-            hpx::naming::gid_type const& id, std::uint64_t count = 1)
-      : key_(hpx::naming::detail::get_stripped_gid(id),
-            hpx::naming::detail::get_stripped_gid(id) + (count - 1))
-    {
-        HPX_TEST(count);
-    }
-
-    hpx::naming::gid_type get_gid() const
-    {
-        return key_.first;
-    }
-
-    std::uint64_t get_count() const
-    {
-        hpx::naming::gid_type const size = key_.second - key_.first;
-        HPX_TEST(size.get_msb() == 0);
-        return size.get_lsb();
-    }
-
-    friend bool operator<(gva_cache_key const& lhs, gva_cache_key const& rhs)
-    {
-        return lhs.key_.second < rhs.key_.first;
-    }
-
-    friend bool operator==(gva_cache_key const& lhs, gva_cache_key const& rhs)
-    {
-        // Direct hit
-        if (lhs.key_ == rhs.key_)
-        {
-            return true;
-        }
-
-        // Is lhs in rhs?
-        if (1 == lhs.get_count() && 1 != rhs.get_count())
-        {
-            return rhs.key_.first <= lhs.key_.first &&
-                lhs.key_.second <= rhs.key_.second;
-        }
-
-        // Is rhs in lhs?
-        else if (1 != lhs.get_count() && 1 == rhs.get_count())
-        {
-            return lhs.key_.first <= rhs.key_.first &&
-                rhs.key_.second <= lhs.key_.second;
-        }
-
-        return false;
-    }
-};
-
-struct gva_erase_policy
-{
-    gva_erase_policy(hpx::naming::gid_type const& id, std::uint64_t count)
-      : entry(id, count)
-    {}
-
-    typedef std::pair<gva_cache_key, gva_entry_type> entry_type;
-
-    bool operator()(entry_type const& p) const
-    {
-        return p.first == entry;
-    }
-
-    gva_cache_key entry;
-};
-
-typedef hpx::util::cache::local_cache<
-    gva_cache_key, gva_entry_type, std::less<gva_entry_type>,
-    hpx::util::cache::policies::always<gva_entry_type>,
-    std::map<gva_cache_key, gva_entry_type>,
-    hpx::util::cache::statistics::local_full_statistics
-> gva_cache_type;
+using hpx::agas::detail::gva_cache_key;
+typedef hpx::agas::detail::gva_cache gva_cache_type;
 
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(std::string const& prefix,
@@ -176,7 +85,7 @@ void test_insert(gva_cache_type& cache, std::size_t num_entries)
 
         std::uint64_t t = hpx::util::high_resolution_clock::now();
 
-        cache.insert(key, value);
+        cache.update(key, value);
 
         timings.push_back(hpx::util::high_resolution_clock::now() - t);
     }
@@ -184,12 +93,13 @@ void test_insert(gva_cache_type& cache, std::size_t num_entries)
     calculate_histogram("insert", timings);
 }
 
-void test_get(gva_cache_type& cache, hpx::naming::gid_type first_key)
+void test_get(gva_cache_type& cache, hpx::naming::gid_type first_key,
+    std::size_t num_entries)
 {
     std::vector<std::uint64_t> timings;
-    timings.reserve(cache.size());
+    timings.reserve(num_entries);
 
-    for (std::size_t i = 0; i != cache.size(); ++i)
+    for (std::size_t i = 0; i != num_entries; ++i)
     {
         gva_cache_key key(++first_key, 1);
         gva_cache_key idbase;
@@ -205,15 +115,16 @@ void test_get(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("   get", timings);
 }
 
-void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
+void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key,
+    std::size_t num_entries)
 {
     hpx::naming::gid_type locality = hpx::get_locality();
     std::uint32_t ct = hpx::components::component_invalid;
 
     std::vector<std::uint64_t> timings;
-    timings.reserve(cache.size());
+    timings.reserve(num_entries);
 
-    for (std::size_t i = 0; i != cache.size(); ++i)
+    for (std::size_t i = 0; i != num_entries; ++i)
     {
         gva_cache_key key(++first_key, 1);
         hpx::agas::gva value(locality, ct, 1, std::uint64_t(1), 1);
@@ -228,6 +139,41 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+// Look up the entries from all worker threads at the same time, the number
+// of lookups per second should scale with the number of threads.
+void test_concurrent_get(gva_cache_type& cache,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_threads);
+
+    hpx::util::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        tasks.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                gva_cache_key key(
+                    first_key + ((i + j) % num_entries + 1), 1);
+                gva_cache_key idbase;
+                gva_cache_type::entry_type e;
+
+                cache.get_entry(key, idbase, e);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    double elapsed = t.elapsed();
+    std::cout << "concurrent get (" << num_threads << " threads): "
+              << (num_threads * num_lookups) / elapsed << " lookups/s"
+              << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -239,16 +185,20 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
-    gva_cache_type cache;
-    cache.reserve(cache_size);
+    std::size_t num_lookups = 1000000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    gva_cache_type cache(cache_size, hpx::get_os_thread_count());
 
     hpx::naming::gid_type first_key = hpx::detail::get_next_id();
 
     hpx::util::high_resolution_timer t1;
 
     test_insert(cache, num_entries);
-    test_get(cache, first_key);
-    test_update(cache, first_key);
+    test_get(cache, first_key, num_entries);
+    test_update(cache, first_key, num_entries);
+    test_concurrent_get(cache, first_key, num_entries, num_lookups);
 
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
@@ -268,6 +218,8 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("num_lookups", value<std::size_t>(),
+         "number of concurrent lookups per thread (default: 1000000)")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,125 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the primary namespace server (bind, resolve,
+// increment and decrement of credits) while being accessed from all worker
+// threads concurrently.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/testing.hpp>
+
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using hpx::agas::server::primary_namespace;
+
+///////////////////////////////////////////////////////////////////////////////
+// run f(task, i) for all i in [0, num_ids) on each of the tasks and report
+// the number of operations per second
+template <typename F>
+void measure(std::string const& name, std::size_t num_tasks,
+    std::size_t num_ids, F&& f)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::util::high_resolution_timer t;
+
+    for (std::size_t task = 0; task != num_tasks; ++task)
+    {
+        tasks.push_back(hpx::async([&f, task, num_ids]() {
+            for (std::size_t i = 0; i != num_ids; ++i)
+            {
+                f(task, i);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    double elapsed = t.elapsed();
+    std::cout << name << " (" << num_tasks << " threads): "
+              << (num_tasks * num_ids) / elapsed << " ops/s" << std::endl;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_ids = 10000;
+    if (vm.count("num_ids"))
+        num_ids = vm["num_ids"].as<std::size_t>();
+
+    std::size_t const num_tasks = hpx::get_os_thread_count();
+
+    // use a separate instance of the server to measure the tables only
+    primary_namespace pns;
+
+    hpx::naming::gid_type const locality = hpx::get_locality();
+    hpx::naming::gid_type const first_id =
+        hpx::detail::get_next_id(num_tasks * num_ids);
+
+    auto get_id = [&](std::size_t task, std::size_t i) {
+        return first_id + std::uint64_t(task * num_ids + i);
+    };
+
+    hpx::util::high_resolution_timer t1;
+
+    measure("bind", num_tasks, num_ids, [&](std::size_t task, std::size_t i) {
+        hpx::agas::gva g(locality, hpx::components::component_runtime_support,
+            1, std::uint64_t(task * num_ids + i + 1));
+        pns.bind_gid(g, get_id(task, i), locality);
+    });
+
+    measure("resolve", num_tasks, num_ids,
+        [&](std::size_t task, std::size_t i) {
+            pns.resolve_gid(get_id(task, i));
+        });
+
+    measure("increment credit", num_tasks, num_ids,
+        [&](std::size_t task, std::size_t i) {
+            hpx::naming::gid_type const id = get_id(task, i);
+            pns.increment_credit(1, id, id);
+        });
+
+    // each request removes the credit added above, the objects are not
+    // released
+    measure("decrement credit", num_tasks, num_ids,
+        [&](std::size_t task, std::size_t i) {
+            hpx::naming::gid_type const id = get_id(task, i);
+            pns.decrement_credit(
+                {hpx::util::make_tuple(std::int64_t(-1), id, id)});
+        });
+
+    measure("unbind", num_tasks, num_ids, [&](std::size_t task, std::size_t i) {
+        pns.unbind_gid(1, get_id(task, i));
+    });
+
+    double elapsed = t1.elapsed();
+    hpx::util::print_cdash_timing("AGASPrimaryNamespace", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("num_ids,n", value<std::size_t>(),
+         "number of ids bound by each thread (default: 10000)")
+        ;
+
+    // Initialize and run HPX
+    return hpx::init(desc_commandline, argc, argv);
+}
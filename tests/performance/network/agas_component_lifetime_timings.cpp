@@ -0,0 +1,129 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the time needed to create a large number of components in bulk on
+// all localities and to destroy them again once the last reference to them
+// has been released. The default scenario creates 10M components, run it on
+// 4 localities, e.g.:
+//
+//     mpirun -np 4 agas_component_lifetime_timings
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/testing.hpp>
+
+#include <hpx/program_options.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> alive(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+
+    ~test_server()
+    {
+        --alive;
+    }
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+std::size_t get_alive()
+{
+    hpx::agas::garbage_collect();
+    return alive.load();
+}
+HPX_PLAIN_ACTION(get_alive, get_alive_action);
+
+///////////////////////////////////////////////////////////////////////////////
+// the number of components still alive on all localities
+std::size_t count_alive(std::vector<hpx::id_type> const& localities)
+{
+    std::vector<hpx::future<std::size_t>> counts;
+    counts.reserve(localities.size());
+    for (hpx::id_type const& locality : localities)
+    {
+        counts.push_back(hpx::async<get_alive_action>(locality));
+    }
+
+    std::size_t result = 0;
+    for (hpx::future<std::size_t>& count : counts)
+        result += count.get();
+    return result;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_components = 10000000;
+    if (vm.count("num_components"))
+        num_components = vm["num_components"].as<std::size_t>();
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::size_t const per_locality = num_components / localities.size();
+
+    hpx::util::high_resolution_timer t;
+
+    std::vector<hpx::future<std::vector<hpx::id_type>>> created;
+    created.reserve(localities.size());
+    for (hpx::id_type const& locality : localities)
+    {
+        created.push_back(hpx::new_<test_server[]>(locality, per_locality));
+    }
+    hpx::wait_all(created);
+
+    double const elapsed_create = t.elapsed();
+    std::size_t const total = count_alive(localities);
+
+    // release all references at once, this will destroy all components
+    t.restart();
+
+    created.clear();
+    while (count_alive(localities) != 0)
+    {
+        hpx::this_thread::yield();
+    }
+
+    double const elapsed_destroy = t.elapsed();
+
+    std::cout << "components: " << total << " (" << localities.size()
+              << " localities)\n"
+              << "create: " << elapsed_create << " s ("
+              << total / elapsed_create << " components/s)\n"
+              << "destroy: " << elapsed_destroy << " s ("
+              << total / elapsed_destroy << " components/s)" << std::endl;
+
+    hpx::util::print_cdash_timing(
+        "AGASComponentLifetime", elapsed_create + elapsed_destroy);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("num_components,n", value<std::size_t>(),
+         "number of components created on all localities (default: 10000000)")
+        ;
+
+    // Initialize and run HPX
+    return hpx::init(desc_commandline, argc, argv);
+}
@@ -189,11 +189,33 @@ void test_find_id_from_basename()
     }
 }
 
+void test_find_id_after_unregister()
+{
+    char const* basename = "/find_id_after_unregister_test/";
+
+    test_client t1 = test_client::create(hpx::find_here());
+    HPX_TEST((hpx::register_with_basename(basename, t1.get_id()).get()));
+
+    // repeated lookups may be answered from the local symbol cache
+    HPX_TEST_EQ(hpx::find_from_basename(basename).get(), t1.get_id());
+    HPX_TEST_EQ(hpx::find_from_basename(basename).get(), t1.get_id());
+
+    // unregistering the name invalidates the cached entries
+    HPX_TEST_EQ(hpx::unregister_with_basename(basename).get(), t1.get_id());
+
+    test_client t2 = test_client::create(hpx::find_here());
+    HPX_TEST((hpx::register_with_basename(basename, t2.get_id()).get()));
+    HPX_TEST_EQ(hpx::find_from_basename(basename).get(), t2.get_id());
+
+    HPX_TEST_EQ(hpx::unregister_with_basename(basename).get(), t2.get_id());
+}
+
 int hpx_main()
 {
     test_find_id_from_basename();
     test_find_ids_from_basename();
     test_find_all_ids_from_basename();
+    test_find_id_after_unregister();
     return hpx::finalize();
 }
 
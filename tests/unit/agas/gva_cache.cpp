@@ -0,0 +1,246 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::agas::detail::gva_cache_key;
+using hpx::naming::gid_type;
+
+gid_type const locality(0x100000001ULL, 0);
+std::uint64_t const msb = 0x200000001ULL;
+
+gva make_gva(std::uint64_t lva, std::uint64_t count = 1)
+{
+    return gva(locality, 1, count, lva, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_entries()
+{
+    gva_cache cache(1024, 4);
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(cache.update(gva_cache_key(gid_type(msb, i * 4096)),
+            make_gva(i + 1)));
+    }
+    HPX_TEST_EQ(cache.size(), std::size_t(100));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        gva_cache_key idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(
+            gva_cache_key(gid_type(msb, i * 4096)), idbase, g));
+        HPX_TEST_EQ(idbase.get_gid(), gid_type(msb, i * 4096));
+        HPX_TEST_EQ(g.lva(), i + 1);
+    }
+
+    // unknown id
+    gva_cache_key idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(gva_cache_key(gid_type(msb, 1)), idbase, g));
+
+    // updating an entry replaces its value
+    HPX_TEST(cache.update(gva_cache_key(gid_type(msb, 0)), make_gva(42)));
+    HPX_TEST(cache.get_entry(gva_cache_key(gid_type(msb, 0)), idbase, g));
+    HPX_TEST_EQ(g.lva(), std::uint64_t(42));
+
+    cache.erase(gid_type(msb, 0));
+    HPX_TEST(!cache.get_entry(gva_cache_key(gid_type(msb, 0)), idbase, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(99));
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+}
+
+void test_range_entries()
+{
+    gva_cache cache(1024, 4);
+
+    std::uint64_t const count = 10000;
+    gid_type const base(msb, 12345);
+    HPX_TEST(cache.update(gva_cache_key(base, count), make_gva(8, count)));
+
+    for (std::uint64_t i = 0; i < count; i += 77)
+    {
+        gva_cache_key idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(
+            gva_cache_key(base + i), idbase, g));
+        HPX_TEST_EQ(idbase.get_gid(), base);
+        HPX_TEST_EQ(g.count, count);
+    }
+
+    // ids outside of the range
+    gva_cache_key idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(
+        gva_cache_key(base - gid_type(1)), idbase, g));
+    HPX_TEST(!cache.get_entry(
+        gva_cache_key(base + count), idbase, g));
+
+    // an entry colliding with the range replaces the (stale) range
+    HPX_TEST(cache.update(
+        gva_cache_key(base + 1), make_gva(16)));
+    HPX_TEST(cache.get_entry(
+        gva_cache_key(base + 1), idbase, g));
+    HPX_TEST_EQ(idbase.get_gid(), base + 1);
+    HPX_TEST_EQ(g.lva(), std::uint64_t(16));
+    HPX_TEST(!cache.get_entry(
+        gva_cache_key(base + 2), idbase, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(1));
+
+    cache.erase(base + 1);
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+}
+
+void test_bulk_entries()
+{
+    gva_cache cache(1024, 4);
+
+    // components created in bulk: consecutive ids at equidistant addresses
+    std::uint64_t const block_size =
+        std::uint64_t(1) << gva_cache::range_block_bits;
+    std::uint64_t const count = 4 * block_size;
+    std::uint64_t const stride = 64;
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(cache.update(
+            gva_cache_key(gid_type(msb, i)), make_gva(0x10000 + i * stride)));
+    }
+
+    // one entry per block of ids
+    HPX_TEST_EQ(cache.size(), std::size_t(4));
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        gva_cache_key idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(gva_cache_key(gid_type(msb, i)), idbase, g));
+        HPX_TEST_EQ(idbase.get_gid(), gid_type(msb, i & ~(block_size - 1)));
+        HPX_TEST_EQ(g.lva(gid_type(msb, i), idbase.get_gid()),
+            0x10000 + i * stride);
+    }
+
+    // updating an id with the same address is consistent with the range
+    HPX_TEST(cache.update(
+        gva_cache_key(gid_type(msb, 5)), make_gva(0x10000 + 5 * stride)));
+    HPX_TEST_EQ(cache.size(), std::size_t(4));
+
+    // removing one of the ids invalidates the entry of its block
+    cache.erase(gid_type(msb, block_size + 3));
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+
+    gva_cache_key idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(
+        gva_cache_key(gid_type(msb, block_size + 4)), idbase, g));
+    HPX_TEST(cache.get_entry(gva_cache_key(gid_type(msb, 4)), idbase, g));
+
+    // an id resolving to a different address replaces the entry of its block
+    HPX_TEST(cache.update(gva_cache_key(gid_type(msb, 5)), make_gva(8)));
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+    HPX_TEST(cache.get_entry(gva_cache_key(gid_type(msb, 5)), idbase, g));
+    HPX_TEST_EQ(g.lva(), std::uint64_t(8));
+    HPX_TEST(!cache.get_entry(gva_cache_key(gid_type(msb, 4)), idbase, g));
+
+    // a different component type or locality starts a new entry
+    gid_type const other(msb, count);
+    HPX_TEST(cache.update(gva_cache_key(other),
+        gva(locality, 2, 1, 0x10000 + count * stride, 0)));
+    HPX_TEST_EQ(cache.size(), std::size_t(4));
+}
+
+void test_eviction()
+{
+    // small enough to be held by a single shard
+    std::size_t const max_size = 16;
+    gva_cache cache(max_size, 1);
+    HPX_TEST_EQ(cache.num_shards(), std::size_t(1));
+
+    // decreasing addresses prevent combining the entries into ranges
+    for (std::uint64_t i = 0; i != 10 * max_size; ++i)
+    {
+        HPX_TEST(cache.update(
+            gva_cache_key(gid_type(msb, i)), make_gva(10 * max_size - i)));
+        HPX_TEST(cache.size() <= max_size);
+
+        // keep the first entry alive by accessing it
+        gva_cache_key idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(gva_cache_key(gid_type(msb, 0)), idbase, g));
+    }
+    HPX_TEST_EQ(cache.size(), max_size);
+
+    using statistics_type = gva_cache::statistics_type;
+    HPX_TEST_EQ(cache.get_statistics([](statistics_type& s) {
+        return s.insertions(false);
+    }), std::int64_t(10 * max_size));
+    HPX_TEST_EQ(cache.get_statistics([](statistics_type& s) {
+        return s.evictions(false);
+    }), std::int64_t(9 * max_size));
+    HPX_TEST_EQ(cache.get_statistics([](statistics_type& s) {
+        return s.hits(false);
+    }), std::int64_t(10 * max_size));
+}
+
+void test_concurrent_access()
+{
+    std::size_t const num_threads = 4;
+    std::uint64_t const num_entries = 4096;
+
+    gva_cache cache(num_entries, num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&cache, t]() {
+            for (std::uint64_t i = t; i < num_entries; i += num_threads)
+            {
+                cache.update(gva_cache_key(gid_type(msb, i)), make_gva(i + 1));
+            }
+            for (std::uint64_t i = 0; i != num_entries; ++i)
+            {
+                gva_cache_key idbase;
+                gva g;
+                if (cache.get_entry(
+                        gva_cache_key(gid_type(msb, i)), idbase, g))
+                {
+                    HPX_TEST_EQ(
+                        g.lva(gid_type(msb, i), idbase.get_gid()), i + 1);
+                }
+            }
+        });
+    }
+    for (std::thread& t : threads)
+        t.join();
+
+    HPX_TEST(cache.size() <= num_entries + cache.num_shards());
+}
+
+int main()
+{
+    test_single_entries();
+    test_range_entries();
+    test_bulk_entries();
+    test_eviction();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
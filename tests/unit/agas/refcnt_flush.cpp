@@ -0,0 +1,115 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that decref requests which are buffered by the
+// addressing service are sent even if fewer than max_pending_refcnt_requests
+// have accumulated: by the flush timer if it is enabled
+// (hpx.agas.refcnt_flush_interval) and during shutdown otherwise.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/testing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tests/unit/agas/components/managed_refcnt_checker.hpp>
+
+using hpx::test::managed_refcnt_monitor;
+
+std::uint64_t delay = 0;
+
+// the monitor of the object released right before shutdown
+std::unique_ptr<managed_refcnt_monitor> shutdown_monitor;
+
+///////////////////////////////////////////////////////////////////////////////
+void on_shutdown()
+{
+    // the decref request has been sent by addressing_service::start_shutdown
+    HPX_TEST_EQ(true,
+        shutdown_monitor->is_ready(std::chrono::milliseconds(delay)));
+
+    shutdown_monitor.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<managed_refcnt_monitor> release_remote_object()
+{
+    std::vector<hpx::id_type> remote_localities =
+        hpx::find_remote_localities(hpx::components::get_component_type<
+            managed_refcnt_monitor::server_type>());
+
+    if (remote_localities.empty())
+        throw std::logic_error("this test cannot be run on one locality");
+
+    std::unique_ptr<managed_refcnt_monitor> monitor(
+        new managed_refcnt_monitor(remote_localities[0]));
+
+    // the decref request for the last reference is buffered locally
+    monitor->detach().get();
+
+    return monitor;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    delay = vm["delay"].as<std::uint64_t>();
+
+    std::int64_t const flush_interval = std::stoll(
+        hpx::get_config_entry("hpx.agas.refcnt_flush_interval", "0"));
+
+    std::unique_ptr<managed_refcnt_monitor> monitor = release_remote_object();
+    if (flush_interval != 0)
+    {
+        // the flush timer sends the request, the object has to be destroyed
+        // without explicitly collecting garbage
+        HPX_TEST_EQ(true, monitor->is_ready(std::chrono::milliseconds(delay)));
+    }
+    else
+    {
+        // nothing sends the request before shutdown
+        HPX_TEST_EQ(
+            false, monitor->is_ready(std::chrono::milliseconds(delay)));
+
+        shutdown_monitor = std::move(monitor);
+        hpx::register_shutdown_function(on_shutdown);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("delay",
+        value<std::uint64_t>()->default_value(1000),
+        "number of milliseconds to wait for object destruction");
+
+    // We need to explicitly enable the test component used by this test,
+    // a single decref request never fills the buffer.
+    std::vector<std::string> const cfg = {
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.max_pending_refcnt_requests = 1000"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(cmdline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    // the shutdown function resets the monitor after checking it
+    HPX_TEST(!shutdown_monitor);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,143 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::simple_component_base<test_server>
+{
+    hpx::id_type call() const { return hpx::find_here(); }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call);
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_items_count()
+{
+    using hpx::components::detail::get_communication_items_count;
+    using hpx::components::detail::get_communication_partner;
+
+    // objects are distributed proportionally to the traffic
+    std::vector<std::size_t> to_create =
+        get_communication_items_count(100, {300, 100, 0, 600}, {0, 0, 0, 0});
+    HPX_TEST_EQ(to_create.size(), std::size_t(4));
+    HPX_TEST_EQ(to_create[0], std::size_t(30));
+    HPX_TEST_EQ(to_create[1], std::size_t(10));
+    HPX_TEST_EQ(to_create[2], std::size_t(0));
+    HPX_TEST_EQ(to_create[3], std::size_t(60));
+
+    // the remainder goes to the locality with the most traffic
+    to_create = get_communication_items_count(10, {1, 1, 1}, {5, 0, 5});
+    HPX_TEST_EQ(to_create[0], std::size_t(3));
+    HPX_TEST_EQ(to_create[1], std::size_t(4));
+    HPX_TEST_EQ(to_create[2], std::size_t(3));
+
+    // without any traffic the number of instances is balanced
+    to_create = get_communication_items_count(4, {0, 0}, {3, 1});
+    HPX_TEST_EQ(to_create[0], std::size_t(1));
+    HPX_TEST_EQ(to_create[1], std::size_t(3));
+
+    HPX_TEST_EQ(get_communication_partner({1, 7, 7}, {0, 2, 1}),
+        std::size_t(2));
+    HPX_TEST_EQ(get_communication_partner({0, 0}, {4, 2}), std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// invoke the action on the given object from the locality this is executed on
+void generate_traffic(hpx::id_type const& target, int count)
+{
+    for (int i = 0; i != count; ++i)
+    {
+        hpx::async<call_action>(target).get();
+    }
+}
+HPX_PLAIN_ACTION(generate_traffic, generate_traffic_action);
+
+// returns the locality expected to receive the new objects
+hpx::id_type generate_traffic_from_remote()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+        return hpx::find_here();
+
+    // only the remote locality sends parcels for call_action, the objects
+    // are verified below without invoking call_action
+    hpx::id_type target = hpx::new_<test_server>(hpx::find_here()).get();
+    hpx::async<generate_traffic_action>(localities.back(), target, 10).get();
+
+    return localities.back();
+}
+
+void test_location(hpx::id_type const& id, hpx::id_type const& expected,
+    std::vector<hpx::id_type> const& localities)
+{
+    hpx::id_type loc = hpx::get_colocation_id(id).get();
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+    HPX_TEST(loc == expected);
+    (void) localities;
+#else
+    // without the per-action counters the objects are balanced
+    HPX_TEST(std::find(localities.begin(), localities.end(), loc) !=
+        localities.end());
+    (void) expected;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_communication_multiple(hpx::id_type const& expected)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::size_t const count = 10 * localities.size();
+    std::vector<hpx::id_type> ids = hpx::new_<test_server[]>(
+        hpx::communication_aware.for_action<call_action>(localities), count)
+        .get();
+    HPX_TEST_EQ(ids.size(), count);
+
+    // all of the traffic is generated by a single locality
+    for (hpx::id_type const& id : ids)
+    {
+        test_location(id, expected, localities);
+    }
+}
+
+void test_communication_single(hpx::id_type const& expected)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::id_type id = hpx::new_<test_server>(
+        hpx::communication_aware.for_action<call_action>(localities)).get();
+    test_location(id, expected, localities);
+
+    // the default instance creates objects locally
+    id = hpx::new_<test_server>(hpx::communication_aware).get();
+    HPX_TEST(hpx::get_colocation_id(id).get() == hpx::find_here());
+}
+
+int main()
+{
+    test_items_count();
+
+    // only the traffic since the previous placement is taken into account
+    test_communication_single(generate_traffic_from_remote());
+    test_communication_multiple(generate_traffic_from_remote());
+
+    return hpx::util::report_errors();
+}
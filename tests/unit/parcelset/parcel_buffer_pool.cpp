@@ -0,0 +1,84 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_buffer_pool.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+typedef hpx::parcelset::parcel_buffer<std::vector<char> > buffer_type;
+typedef hpx::parcelset::detail::parcel_buffer_pool<buffer_type> pool_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_presized()
+{
+    pool_type pool;
+
+    buffer_type buffer = pool.get(10000);
+    HPX_TEST(buffer.data_.empty());
+    HPX_TEST_LTE(std::size_t(10000), buffer.data_.capacity());
+    HPX_TEST_EQ(pool.misses(true), std::size_t(1));
+    HPX_TEST_EQ(pool.hits(true), std::size_t(0));
+}
+
+void test_recycling()
+{
+    pool_type pool;
+
+    buffer_type buffer = pool.get(10000);
+    buffer.data_.resize(10000);
+    char const* data = buffer.data_.data();
+
+    pool.reclaim(std::move(buffer));
+
+    // a smaller request is satisfied from the larger size class
+    buffer_type recycled = pool.get(100);
+    HPX_TEST(recycled.data_.empty());
+    HPX_TEST_EQ(recycled.data_.data(), data);
+    HPX_TEST_EQ(pool.hits(true), std::size_t(1));
+
+    // a larger request can't be satisfied from the cached buffers
+    pool.reclaim(std::move(recycled));
+    buffer_type larger = pool.get(100000);
+    HPX_TEST_LTE(std::size_t(100000), larger.data_.capacity());
+    HPX_TEST_EQ(pool.misses(true), std::size_t(2));
+}
+
+void test_limits()
+{
+    pool_type pool(1, 64 * 1024);
+
+    HPX_TEST(pool.is_poolable(4096));
+    HPX_TEST(!pool.is_poolable(1024 * 1024));
+
+    // oversized buffers are not retained
+    buffer_type huge = pool.get(1024 * 1024);
+    pool.reclaim(std::move(huge));
+    buffer_type next = pool.get(1024 * 1024);
+    HPX_TEST_EQ(pool.hits(true), std::size_t(0));
+
+    // each size class retains at most max_cached buffers
+    buffer_type b1 = pool.get(8192);
+    buffer_type b2 = pool.get(8192);
+    pool.reclaim(std::move(b1));
+    pool.reclaim(std::move(b2));
+    buffer_type r1 = pool.get(8192);
+    buffer_type r2 = pool.get(8192);
+    HPX_TEST_EQ(pool.hits(true), std::size_t(1));
+}
+
+int main()
+{
+    test_presized();
+    test_recycling();
+    test_limits();
+
+    return hpx::util::report_errors();
+}
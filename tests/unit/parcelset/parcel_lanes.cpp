@@ -0,0 +1,126 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that parcels for high priority actions are not queued
+// behind other parcels sent to the same locality and that the queueing
+// counters of both lanes are maintained.
+
+#include <hpx/hpx.hpp>
+#include <hpx/format.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Executed on the receiving locality: the direct action runs on the thread
+// reading the message from the only cached connection, which can't be used
+// for other parcels until it returns. The action waits for the high
+// priority parcel to arrive, which is only possible if the parcel was sent
+// over the connection reserved for the priority lane.
+std::atomic<bool> waiting(false);
+std::atomic<bool> urgent_arrived(false);
+
+bool wait_for_urgent()
+{
+    urgent_arrived = false;
+    waiting = true;
+
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!urgent_arrived && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    waiting = false;
+    return urgent_arrived;
+}
+HPX_PLAIN_DIRECT_ACTION(wait_for_urgent);
+
+void urgent()
+{
+    // only arrivals while the connection is blocked count
+    if (waiting)
+        urgent_arrived = true;
+}
+HPX_PLAIN_ACTION(urgent);
+HPX_ACTION_HAS_HIGH_PRIORITY(urgent_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lane_ordering(hpx::id_type const& id)
+{
+    // The high priority parcel may arrive before the connection is blocked,
+    // in which case the round is repeated. If the priority lane did not have
+    // its own connection, the parcel would never arrive while the connection
+    // is blocked.
+    bool arrived = false;
+    for (std::size_t i = 0; i != 5 && !arrived; ++i)
+    {
+        hpx::future<bool> blocked = hpx::async<wait_for_urgent_action>(id);
+
+        hpx::async<urgent_action>(id).get();
+
+        arrived = blocked.get();
+    }
+
+    HPX_TEST(arrived);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_queueing_count(char const* lane)
+{
+    hpx::performance_counters::performance_counter c(hpx::util::format(
+        "/parcelqueue{{locality#{}/total}}/count/tcp/{}",
+        hpx::get_locality_id(), lane));
+
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_lane_counters()
+{
+    HPX_TEST_LT(std::int64_t(0), get_queueing_count("normal"));
+    HPX_TEST_LT(std::int64_t(0), get_queueing_count("priority"));
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_lane_ordering(id);
+    }
+
+    if (!hpx::find_remote_localities().empty())
+    {
+        test_lane_counters();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use a single cached connection per locality, otherwise the parcels
+    // could be sent over another cached connection, the message blocking
+    // the connection occupies one of the threads of the parcel pool
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.max_connections_per_locality=1",
+        "hpx.threadpools.parcel_pool_size=4"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
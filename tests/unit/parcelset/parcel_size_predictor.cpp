@@ -0,0 +1,92 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_size_predictor.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+typedef hpx::parcelset::detail::parcel_size_predictor predictor_type;
+
+// the predictor identifies actions by the address of their name
+char const* const action = "test_action";
+char const* const other_action = "other_test_action";
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unknown_action()
+{
+    predictor_type predictor;
+
+    predictor_type::estimate e = predictor.predict(action, 1000, 2);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(1000));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(0));
+    HPX_TEST_EQ(e.num_chunks_, std::size_t(2));
+}
+
+void test_convergence()
+{
+    predictor_type predictor;
+
+    predictor_type::estimate first = {100, 4000, 2};
+    predictor.update(action, first);
+
+    // the first sample is taken as is
+    predictor_type::estimate e = predictor.predict(action, 0, 0);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(100));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(4000));
+    HPX_TEST_EQ(e.num_chunks_, std::size_t(2));
+
+    // the estimate converges towards the new size
+    predictor_type::estimate actual = {200, 8000, 3};
+    for (int i = 0; i != 200; ++i)
+        predictor.update(action, actual);
+
+    e = predictor.predict(action, 0, 0);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(200));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(8000));
+    HPX_TEST_EQ(e.num_chunks_, std::size_t(3));
+
+    // a known parcel size is split according to the estimate
+    e = predictor.predict(action, 8200, 1);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(200));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(8000));
+    HPX_TEST_EQ(e.num_chunks_, std::size_t(3));
+
+    // the zero-copy part can't exceed the parcel size
+    e = predictor.predict(action, 1000, 1);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(0));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(1000));
+
+    // other actions are not affected
+    e = predictor.predict(other_action, 1000, 1);
+    HPX_TEST_EQ(e.inline_bytes_, std::size_t(1000));
+    HPX_TEST_EQ(e.zero_copy_bytes_, std::size_t(0));
+    HPX_TEST_EQ(e.num_chunks_, std::size_t(1));
+}
+
+void test_mispredictions()
+{
+    predictor_type predictor;
+    HPX_TEST_EQ(predictor.get_mispredictions(false), std::int64_t(0));
+
+    predictor.add_misprediction();
+    predictor.add_misprediction();
+
+    HPX_TEST_EQ(predictor.get_mispredictions(false), std::int64_t(2));
+    HPX_TEST_EQ(predictor.get_mispredictions(true), std::int64_t(2));
+    HPX_TEST_EQ(predictor.get_mispredictions(false), std::int64_t(0));
+}
+
+int main()
+{
+    test_unknown_action();
+    test_convergence();
+    test_mispredictions();
+
+    return hpx::util::report_errors();
+}
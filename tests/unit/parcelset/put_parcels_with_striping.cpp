@@ -0,0 +1,119 @@
+//  Copyright (c) 2020 STE||AR Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that large messages whose zero-copy chunks are striped
+// over several TCP connections are correctly reassembled by the receiver.
+
+#include <hpx/hpx.hpp>
+#include <hpx/format.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+typedef hpx::serialization::serialize_buffer<char> buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t checksum(buffer_type const& b1, buffer_type const& b2)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i != b1.size(); ++i)
+        sum = sum * 31 + static_cast<unsigned char>(b1[i]);
+    for (std::size_t i = 0; i != b2.size(); ++i)
+        sum = sum * 31 + static_cast<unsigned char>(b2[i]);
+    return sum;
+}
+HPX_PLAIN_ACTION(checksum);
+
+buffer_type make_buffer(std::size_t size, std::size_t seed)
+{
+    buffer_type b(size);
+    for (std::size_t i = 0; i != size; ++i)
+        b[i] = static_cast<char>((i * 7 + seed) % 251);
+    return b;
+}
+
+void test_striping(hpx::id_type const& id, std::size_t size)
+{
+    std::vector<hpx::future<std::uint64_t>> results;
+    std::vector<std::uint64_t> expected;
+
+    // send several messages concurrently to exercise the reassembly of
+    // stripes arriving out of order
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        buffer_type b1 = make_buffer(size, i);
+        buffer_type b2 = make_buffer(size / 3 + 1, i + 1);
+
+        expected.push_back(checksum(b1, b2));
+        results.push_back(hpx::async<checksum_action>(id, b1, b2));
+    }
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+std::int64_t striped_messages()
+{
+    hpx::performance_counters::performance_counter c(hpx::util::format(
+        "/parcels{{locality#{}/total}}/count/tcp/striped",
+        hpx::get_locality_id()));
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// The rails of a connection are connected asynchronously when the first
+// message qualifies for striping, send messages one at a time over the same
+// connection until one of them has been striped.
+void test_striped_message_sent(hpx::id_type const& id)
+{
+    std::int64_t const before = striped_messages();
+
+    buffer_type b1 = make_buffer(64 * 1024, 0);
+    buffer_type b2 = make_buffer(1, 1);
+    std::uint64_t const expected = checksum(b1, b2);
+
+    for (std::size_t i = 0; i != 1000 && striped_messages() == before; ++i)
+    {
+        HPX_TEST_EQ(hpx::async<checksum_action>(id, b1, b2).get(), expected);
+    }
+
+    HPX_TEST_LT(before, striped_messages());
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_striping(id, 1024);                // below striping threshold
+        test_striping(id, 64 * 1024);
+        test_striping(id, 4 * 1024 * 1024 + 3);
+
+        test_striped_message_sent(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.tcp.stripe_connections=4",
+        "hpx.parcel.tcp.stripe_threshold=8192"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}